@@ -38,6 +38,9 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+#include <limits>
+
 #include "DTK_BasicEntitySet.hpp"
 #include "DTK_DBC.hpp"
 
@@ -52,21 +55,23 @@ namespace DataTransferKit
 //---------------------------------------------------------------------------//
 // Default constructor.
 BasicEntitySetIterator::BasicEntitySetIterator()
-    : d_entity( NULL )
+    : d_index( 0 )
+    , d_entity( NULL )
 { /* ... */
 }
 
 //---------------------------------------------------------------------------//
 // Constructor.
 BasicEntitySetIterator::BasicEntitySetIterator(
-    Teuchos::RCP<std::unordered_map<EntityId, Entity>> map,
+    Teuchos::RCP<Teuchos::Array<Entity>> entities,
     const PredicateFunction &predicate )
-    : d_map( map )
-    , d_map_it( d_map->begin() )
+    : d_entities( entities )
+    , d_index( 0 )
+    , d_entity( NULL )
 {
-    if ( ( d_map->size() > 0 ) && ( d_map_it != d_map->end() ) )
+    if ( d_entities->size() > 0 )
     {
-        d_entity = &( d_map_it->second );
+        d_entity = &( *d_entities )[d_index];
     }
     this->b_predicate = predicate;
 }
@@ -75,12 +80,13 @@ BasicEntitySetIterator::BasicEntitySetIterator(
 // Copy constructor.
 BasicEntitySetIterator::BasicEntitySetIterator(
     const BasicEntitySetIterator &rhs )
-    : d_map( rhs.d_map )
-    , d_map_it( rhs.d_map_it )
+    : d_entities( rhs.d_entities )
+    , d_index( rhs.d_index )
+    , d_entity( NULL )
 {
-    if ( ( d_map->size() > 0 ) && ( d_map_it != d_map->end() ) )
+    if ( d_index < d_entities->size() )
     {
-        d_entity = &( d_map_it->second );
+        d_entity = &( *d_entities )[d_index];
     }
     this->b_predicate = rhs.b_predicate;
 }
@@ -95,11 +101,12 @@ operator=( const BasicEntitySetIterator &rhs )
     {
         return *this;
     }
-    d_map = rhs.d_map;
-    d_map_it = rhs.d_map_it;
-    if ( ( d_map->size() > 0 ) && ( d_map_it != d_map->end() ) )
+    d_entities = rhs.d_entities;
+    d_index = rhs.d_index;
+    d_entity = NULL;
+    if ( d_index < d_entities->size() )
     {
-        d_entity = &( d_map_it->second );
+        d_entity = &( *d_entities )[d_index];
     }
     return *this;
 }
@@ -108,7 +115,7 @@ operator=( const BasicEntitySetIterator &rhs )
 // Pre-increment operator.
 EntityIterator &BasicEntitySetIterator::operator++()
 {
-    ++d_map_it;
+    ++d_index;
     return *this;
 }
 
@@ -124,8 +131,8 @@ Entity &BasicEntitySetIterator::operator*( void )
 // Dereference operator.
 Entity *BasicEntitySetIterator::operator->( void )
 {
-    DTK_REQUIRE( d_map_it != d_map->end() );
-    d_entity = &( d_map_it->second );
+    DTK_REQUIRE( d_index < d_entities->size() );
+    d_entity = &( *d_entities )[d_index];
     return d_entity;
 }
 
@@ -138,7 +145,7 @@ bool BasicEntitySetIterator::operator==( const EntityIterator &rhs ) const
     const BasicEntitySetIterator *rhs_vec_impl =
         static_cast<const BasicEntitySetIterator *>(
             rhs_vec->b_iterator_impl.get() );
-    return ( rhs_vec_impl->d_map_it == d_map_it );
+    return ( rhs_vec_impl->d_index == d_index );
 }
 
 //---------------------------------------------------------------------------//
@@ -150,22 +157,23 @@ bool BasicEntitySetIterator::operator!=( const EntityIterator &rhs ) const
     const BasicEntitySetIterator *rhs_vec_impl =
         static_cast<const BasicEntitySetIterator *>(
             rhs_vec->b_iterator_impl.get() );
-    return ( rhs_vec_impl->d_map_it != d_map_it );
+    return ( rhs_vec_impl->d_index != d_index );
 }
 
 //---------------------------------------------------------------------------//
 // An iterator assigned to the beginning.
 EntityIterator BasicEntitySetIterator::begin() const
 {
-    return BasicEntitySetIterator( d_map, this->b_predicate );
+    return BasicEntitySetIterator( d_entities, this->b_predicate );
 }
 
 //---------------------------------------------------------------------------//
 // An iterator assigned to the end.
 EntityIterator BasicEntitySetIterator::end() const
 {
-    BasicEntitySetIterator end_it( d_map, this->b_predicate );
-    end_it.d_map_it = d_map->end();
+    BasicEntitySetIterator end_it( d_entities, this->b_predicate );
+    end_it.d_index = d_entities->size();
+    end_it.d_entity = NULL;
     return end_it;
 }
 
@@ -178,6 +186,22 @@ std::unique_ptr<EntityIterator> BasicEntitySetIterator::clone() const
         new BasicEntitySetIterator( *this ) );
 }
 
+//---------------------------------------------------------------------------//
+// Determine if the iterator is at the end of the entities.
+bool BasicEntitySetIterator::atEnd() const
+{
+    return ( d_index >= d_entities->size() );
+}
+
+//---------------------------------------------------------------------------//
+// Get a view of all the entities under the iterator.
+bool BasicEntitySetIterator::contiguousEntities(
+    Teuchos::ArrayView<Entity> &entities ) const
+{
+    entities = ( *d_entities )();
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 // BasicEntitySet implementation.
 //---------------------------------------------------------------------------//
@@ -195,7 +219,18 @@ BasicEntitySet::BasicEntitySet(
 // Add an entity to the set.
 void BasicEntitySet::addEntity( const Entity &entity )
 {
-    d_entities[entity.topologicalDimension()].emplace( entity.id(), entity );
+    EntityBlock &block = d_entities[entity.topologicalDimension()];
+    if ( !block.id_index.emplace( entity.id(), block.ids.size() ).second )
+    {
+        return;
+    }
+    block.entities.push_back( entity );
+    block.ids.push_back( entity.id() );
+    block.owner_ranks.push_back( entity.ownerRank() );
+    Teuchos::Tuple<double, 6> bounds;
+    entity.boundingBox( bounds );
+    block.bounding_boxes.insert( block.bounding_boxes.end(), bounds.begin(),
+                                 bounds.end() );
 }
 
 //---------------------------------------------------------------------------//
@@ -209,14 +244,42 @@ Teuchos::RCP<const Teuchos::Comm<int>> BasicEntitySet::communicator() const
 // Return the physical dimension of the entities in the set.
 int BasicEntitySet::physicalDimension() const { return d_physical_dim; }
 
+//---------------------------------------------------------------------------//
+// Get the local bounding box of entities of the set.
+void BasicEntitySet::localBoundingBox( Teuchos::Tuple<double, 6> &bounds ) const
+{
+    int rank = d_comm->getRank();
+    double max = std::numeric_limits<double>::max();
+    bounds = Teuchos::tuple( max, max, max, -max, -max, -max );
+    for ( const auto &block : d_entities )
+    {
+        int num_entities = block.ids.size();
+        for ( int e = 0; e < num_entities; ++e )
+        {
+            if ( rank == block.owner_ranks[e] )
+            {
+                const double *entity_bounds = &block.bounding_boxes[6 * e];
+                for ( int n = 0; n < 3; ++n )
+                {
+                    bounds[n] = std::min( bounds[n], entity_bounds[n] );
+                    bounds[n + 3] =
+                        std::max( bounds[n + 3], entity_bounds[n + 3] );
+                }
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Given an EntityId, get the entity.
 void BasicEntitySet::getEntity( const EntityId entity_id,
                                 const int topological_dimension,
                                 Entity &entity ) const
 {
-    DTK_CHECK( d_entities[topological_dimension].count( entity_id ) );
-    entity = d_entities[topological_dimension].find( entity_id )->second;
+    const EntityBlock &block = d_entities[topological_dimension];
+    auto index_it = block.id_index.find( entity_id );
+    DTK_INSIST( index_it != block.id_index.end() );
+    entity = block.entities[index_it->second];
 }
 
 //---------------------------------------------------------------------------//
@@ -226,9 +289,9 @@ EntityIterator
 BasicEntitySet::entityIterator( const int topological_dimension,
                                 const PredicateFunction &predicate ) const
 {
-    Teuchos::RCP<std::unordered_map<EntityId, Entity>> map_ptr =
-        Teuchos::rcpFromRef( d_entities[topological_dimension] );
-    return BasicEntitySetIterator( map_ptr, predicate );
+    EntityBlock &block = d_entities[topological_dimension];
+    return BasicEntitySetIterator( Teuchos::rcpFromRef( block.entities ),
+                                   predicate );
 }
 
 //---------------------------------------------------------------------------//
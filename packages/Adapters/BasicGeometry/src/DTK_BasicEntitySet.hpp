@@ -52,6 +52,7 @@
 #include <Teuchos_ArrayView.hpp>
 #include <Teuchos_Comm.hpp>
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Tuple.hpp>
 
 namespace DataTransferKit
 {
@@ -67,9 +68,8 @@ class BasicEntitySetIterator : public EntityIterator
     BasicEntitySetIterator();
 
     // Constructor.
-    BasicEntitySetIterator(
-        Teuchos::RCP<std::unordered_map<EntityId, Entity>> map,
-        const PredicateFunction &predicate );
+    BasicEntitySetIterator( Teuchos::RCP<Teuchos::Array<Entity>> entities,
+                            const PredicateFunction &predicate );
 
     // Copy constructor.
     BasicEntitySetIterator( const BasicEntitySetIterator &rhs );
@@ -104,12 +104,19 @@ class BasicEntitySetIterator : public EntityIterator
     // and assignment operator to pass along the underlying implementation.
     std::unique_ptr<EntityIterator> clone() const override;
 
+    // Determine if the iterator is at the end of the entities.
+    bool atEnd() const override;
+
+    // Get a view of all the entities under the iterator.
+    bool contiguousEntities(
+        Teuchos::ArrayView<Entity> &entities ) const override;
+
   private:
-    // Map to iterate over.
-    Teuchos::RCP<std::unordered_map<EntityId, Entity>> d_map;
+    // Entities to iterate over.
+    Teuchos::RCP<Teuchos::Array<Entity>> d_entities;
 
-    // Iterator over the entity map.
-    std::unordered_map<EntityId, Entity>::iterator d_map_it;
+    // Index of the current entity.
+    int d_index;
 
     // Pointer to the current entity.
     Entity *d_entity;
@@ -119,6 +126,13 @@ class BasicEntitySetIterator : public EntityIterator
 /*!
   \class BasicEntitySet
   \brief Basic implementation of the entity set interface.
+
+  Entities of each topological dimension are stored contiguously in the order
+  they were added along with flat arrays of their ids, owner ranks, and
+  bounding boxes. Iteration and bounding box calculations stream through
+  these arrays. An index from id to array position is updated as entities
+  are added so the const accessors never modify the set. As with a map,
+  adding an entity with an id already in the set has no effect.
 */
 //---------------------------------------------------------------------------//
 class BasicEntitySet : public EntitySet
@@ -156,6 +170,12 @@ class BasicEntitySet : public EntitySet
      * \return The physical dimension of the set.
      */
     int physicalDimension() const override;
+
+    /*!
+     * \brief Get the local bounding box of entities of the set.
+     * \return A Cartesian box that bounds all local entities in the set.
+     */
+    void localBoundingBox( Teuchos::Tuple<double, 6> &bounds ) const override;
     //@}
 
     //@{
@@ -192,9 +212,25 @@ class BasicEntitySet : public EntitySet
     //@}
 
   private:
-    // Given a parametric dimension, get an id-to-entity map.
-    std::unordered_map<EntityId, Entity> &
-    getEntityMap( const int parametric_dimension );
+    // Entities of a single topological dimension stored as a structure of
+    // arrays.
+    struct EntityBlock
+    {
+        // Entities in the order they were added.
+        Teuchos::Array<Entity> entities;
+
+        // Entity ids.
+        Teuchos::Array<EntityId> ids;
+
+        // Entity owner ranks.
+        Teuchos::Array<int> owner_ranks;
+
+        // Entity bounding boxes, 6 values per entity.
+        Teuchos::Array<double> bounding_boxes;
+
+        // Map of entity ids to their indices in the arrays.
+        std::unordered_map<EntityId, int> id_index;
+    };
 
   private:
     // Parallel communicator.
@@ -203,8 +239,10 @@ class BasicEntitySet : public EntitySet
     // Physical dimension.
     int d_physical_dim;
 
-    // Id-to-entity maps.
-    mutable Teuchos::Array<std::unordered_map<EntityId, Entity>> d_entities;
+    // Entity blocks for each topological dimension. Mutable only so the
+    // iterators can reference the entities. The const accessors do not
+    // modify the blocks.
+    mutable Teuchos::Array<EntityBlock> d_entities;
 };
 
 //---------------------------------------------------------------------------//
@@ -38,6 +38,8 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <functional>
+
 #include "DTK_EntityCenteredField.hpp"
 #include "DTK_DBC.hpp"
 
@@ -126,6 +128,95 @@ void EntityCenteredField::writeFieldData( const SupportId support_id,
     }
 }
 
+//---------------------------------------------------------------------------//
+// Given a set of local dof ids and a dimension, read data from the
+// application field.
+void EntityCenteredField::readFieldDataBulk(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int dimension, const Teuchos::ArrayView<double> &data ) const
+{
+    DTK_REQUIRE( support_ids.size() == data.size() );
+    int offset = 0;
+    int stride = 0;
+    dataOffsetAndStride( dimension, offset, stride );
+    int id_offset = supportIdOffset( support_ids );
+    int num_ids = support_ids.size();
+    for ( int n = 0; n < num_ids; ++n )
+    {
+        data[n] =
+            d_data[offset + localId( support_ids, id_offset, n ) * stride];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Given a set of local dof ids, dimension, and field values, write data into
+// the application field.
+void EntityCenteredField::writeFieldDataBulk(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int dimension, const Teuchos::ArrayView<const double> &data )
+{
+    DTK_REQUIRE( support_ids.size() == data.size() );
+    int offset = 0;
+    int stride = 0;
+    dataOffsetAndStride( dimension, offset, stride );
+    int id_offset = supportIdOffset( support_ids );
+    int num_ids = support_ids.size();
+    for ( int n = 0; n < num_ids; ++n )
+    {
+        d_data[offset + localId( support_ids, id_offset, n ) * stride] =
+            data[n];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Get a view of the field data if it is stored contiguously in BLOCKED
+// order.
+Teuchos::ArrayRCP<double> EntityCenteredField::viewBlockedData()
+{
+    return ( BLOCKED == d_layout ) ? d_data : Teuchos::ArrayRCP<double>();
+}
+
+//---------------------------------------------------------------------------//
+// Get the offset of a list of support ids in the field's own support id
+// list. Return -1 if the list is not a view of the field's own list.
+int EntityCenteredField::supportIdOffset(
+    const Teuchos::ArrayView<const SupportId> &support_ids ) const
+{
+    std::less<const SupportId *> less;
+    const SupportId *begin = d_support_ids.getRawPtr();
+    const SupportId *end = begin + d_support_ids.size();
+    const SupportId *ids = support_ids.getRawPtr();
+    if ( !less( ids, begin ) && !less( end, ids + support_ids.size() ) )
+    {
+        return ids - begin;
+    }
+    return -1;
+}
+
+//---------------------------------------------------------------------------//
+// Get the local id of a support id in the given list.
+int EntityCenteredField::localId(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int id_offset, const int n ) const
+{
+    if ( id_offset >= 0 )
+    {
+        return id_offset + n;
+    }
+    DTK_REQUIRE( d_id_map.count( support_ids[n] ) );
+    return d_id_map.find( support_ids[n] )->second;
+}
+
+//---------------------------------------------------------------------------//
+// Get the offset and stride of the given dimension in the data.
+void EntityCenteredField::dataOffsetAndStride( const int dimension,
+                                               int &offset,
+                                               int &stride ) const
+{
+    offset = ( BLOCKED == d_layout ) ? dimension * d_lda : dimension;
+    stride = ( BLOCKED == d_layout ) ? 1 : d_field_dim;
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -119,6 +119,52 @@ class EntityCenteredField : public Field
     void writeFieldData( const SupportId support_id, const int dimension,
                          const double data );
 
+    /*!
+     * \brief Given a set of local dof ids and a dimension, read data from the
+     * application field.
+     */
+    void
+    readFieldDataBulk( const Teuchos::ArrayView<const SupportId> &support_ids,
+                       const int dimension,
+                       const Teuchos::ArrayView<double> &data ) const override;
+
+    /*!
+     * \brief Given a set of local dof ids, dimension, and field values, write
+     * data into the application field.
+     */
+    void writeFieldDataBulk(
+        const Teuchos::ArrayView<const SupportId> &support_ids,
+        const int dimension,
+        const Teuchos::ArrayView<const double> &data ) override;
+
+    /*!
+     * \brief Determine if the bulk read and write functions may be called
+     * concurrently.
+     */
+    bool isThreadSafe() const override { return true; }
+
+    /*!
+     * \brief Get a view of the field data if it is stored contiguously in
+     * BLOCKED order.
+     */
+    Teuchos::ArrayRCP<double> viewBlockedData() override;
+
+  private:
+    // Get the offset of a list of support ids in the field's own support id
+    // list. Return -1 if the list is not a view of the field's own list.
+    int supportIdOffset(
+        const Teuchos::ArrayView<const SupportId> &support_ids ) const;
+
+    // Get the local id of a support id in the given list. If the list is a
+    // view of the field's own list at the given offset the local id is
+    // computed directly.
+    int localId( const Teuchos::ArrayView<const SupportId> &support_ids,
+                 const int id_offset, const int n ) const;
+
+    // Get the offset and stride of the given dimension in the data.
+    void dataOffsetAndStride( const int dimension, int &offset,
+                              int &stride ) const;
+
   private:
     // The dof ids of the entities over which the field is constructed.
     Teuchos::Array<SupportId> d_support_ids;
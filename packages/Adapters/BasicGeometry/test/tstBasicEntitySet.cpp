@@ -46,8 +46,10 @@
 #include <sstream>
 #include <vector>
 
+#include <DTK_BasicEntityPredicates.hpp>
 #include <DTK_BasicEntitySet.hpp>
 #include <DTK_BoxGeometry.hpp>
+#include <DTK_FunctionSpace.hpp>
 #include <DTK_Point.hpp>
 
 #include <Teuchos_Array.hpp>
@@ -59,6 +61,7 @@
 #include <Teuchos_Tuple.hpp>
 #include <Teuchos_TypeTraits.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_as.hpp>
 
 //---------------------------------------------------------------------------//
 // MPI Setup
@@ -193,6 +196,211 @@ TEUCHOS_UNIT_TEST( BasicEntitySet, basic_entity_set_test )
                             1.0e-12 );
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( BasicEntitySet, many_points_test )
+{
+    using namespace DataTransferKit;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+
+    // Add points to the set in reverse id order.
+    BasicEntitySet entity_set( comm, 3 );
+    int num_points = 100;
+    Teuchos::Array<double> p( 3 );
+    for ( int i = num_points - 1; i >= 0; --i )
+    {
+        p[0] = i;
+        p[1] = 2.0 * i;
+        p[2] = -1.0 * i;
+        entity_set.addEntity( Point( i, comm_rank, p ) );
+    }
+
+    // Adding a point with an existing id has no effect.
+    p[0] = 1000.0;
+    entity_set.addEntity( Point( 7, comm_rank, p ) );
+
+    // Check the iterator.
+    EntityIterator node_it = entity_set.entityIterator( 0 );
+    TEST_EQUALITY( node_it.size(), num_points );
+    int n = num_points - 1;
+    for ( auto it = node_it.begin(); it != node_it.end(); ++it, --n )
+    {
+        TEST_EQUALITY( it->id(), Teuchos::as<EntityId>( n ) );
+    }
+
+    // Check the lookup.
+    Entity entity;
+    Teuchos::Tuple<double, 6> bounds;
+    for ( int i = 0; i < num_points; ++i )
+    {
+        entity_set.getEntity( i, 0, entity );
+        TEST_EQUALITY( entity.id(), Teuchos::as<EntityId>( i ) );
+        entity.boundingBox( bounds );
+        TEST_EQUALITY( bounds[0], 1.0 * i );
+        TEST_EQUALITY( bounds[1], 2.0 * i );
+        TEST_EQUALITY( bounds[2], -1.0 * i );
+    }
+
+    // Check the local bounding box.
+    entity_set.localBoundingBox( bounds );
+    TEST_EQUALITY( bounds[0], 0.0 );
+    TEST_EQUALITY( bounds[1], 0.0 );
+    TEST_EQUALITY( bounds[2], -1.0 * ( num_points - 1 ) );
+    TEST_EQUALITY( bounds[3], 1.0 * ( num_points - 1 ) );
+    TEST_EQUALITY( bounds[4], 2.0 * ( num_points - 1 ) );
+    TEST_EQUALITY( bounds[5], 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( BasicEntitySet, predicate_iterator_test )
+{
+    using namespace DataTransferKit;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+
+    // Add points to the set.
+    BasicEntitySet entity_set( comm, 3 );
+    int num_points = 50;
+    Teuchos::Array<double> p( 3, 0.0 );
+    for ( int i = 0; i < num_points; ++i )
+    {
+        p[0] = i;
+        entity_set.addEntity( Point( i, comm_rank, p ) );
+    }
+
+    // Select the points with even ids.
+    PredicateFunction even = []( Entity e ) { return ( 0 == e.id() % 2 ); };
+    EntityIterator even_it = entity_set.entityIterator( 0, even );
+    TEST_EQUALITY( even_it.size(), Teuchos::as<std::size_t>( num_points / 2 ) );
+
+    // Gathering the entities gives the same entities as stepping through the
+    // iterator.
+    Teuchos::Array<Entity> entities;
+    even_it.getEntities( entities );
+    TEST_EQUALITY( entities.size(), num_points / 2 );
+    int n = 0;
+    for ( auto it = even_it.begin(); it != even_it.end(); ++it, ++n )
+    {
+        TEST_EQUALITY( it->id(), entities[n].id() );
+        TEST_EQUALITY( entities[n].id(), Teuchos::as<EntityId>( 2 * n ) );
+    }
+    TEST_EQUALITY( n, num_points / 2 );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( BasicEntitySet, selected_iterator_test )
+{
+    using namespace DataTransferKit;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+
+    // Add boxes in alternating blocks.
+    BasicEntitySet entity_set( comm, 3 );
+    int num_boxes = 10;
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        entity_set.addEntity( BoxGeometry( i, comm_rank, i % 2, i, 0.0, 0.0,
+                                           i + 1.0, 1.0, 1.0 ) );
+    }
+
+    // Select the boxes in block 1.
+    Teuchos::Array<int> block_ids( 1, 1 );
+    EntityIterator block_it = entity_set.blockEntityIterator( 3, block_ids );
+    TEST_EQUALITY( block_it.size(), Teuchos::as<std::size_t>( num_boxes / 2 ) );
+    for ( auto it = block_it.begin(); it != block_it.end(); ++it )
+    {
+        TEST_ASSERT( it->inBlock( 1 ) );
+        TEST_EQUALITY( it->id() % 2, 1 );
+    }
+
+    // The predicate is only evaluated when the selection is made.
+    int num_calls = 0;
+    PredicateFunction counted = [&num_calls]( Entity e ) {
+        ++num_calls;
+        return ( e.id() < 3 );
+    };
+    EntityIterator selected_it =
+        entity_set.selectedEntityIterator( 3, counted );
+    TEST_EQUALITY( num_calls, num_boxes );
+    TEST_EQUALITY( selected_it.size(), Teuchos::as<std::size_t>( 3 ) );
+    int n = 0;
+    for ( auto it = selected_it.begin(); it != selected_it.end(); ++it, ++n )
+    {
+        TEST_EQUALITY( it->id(), Teuchos::as<EntityId>( n ) );
+    }
+    TEST_EQUALITY( n, 3 );
+    TEST_EQUALITY( num_calls, num_boxes );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( BasicEntitySet, function_space_selection_test )
+{
+    using namespace DataTransferKit;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+
+    // Add boxes in alternating blocks.
+    Teuchos::RCP<BasicEntitySet> entity_set =
+        Teuchos::rcp( new BasicEntitySet( comm, 3 ) );
+    int num_boxes = 10;
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        entity_set->addEntity( BoxGeometry( i, comm_rank, i % 2, i, 0.0, 0.0,
+                                            i + 1.0, 1.0, 1.0 ) );
+    }
+
+    // Select block 1 as a plain block selection and with a select function.
+    Teuchos::Array<int> block_ids( 1, 1 );
+    FunctionSpace block_space( entity_set, Teuchos::null, Teuchos::null,
+                               Teuchos::null, FunctionSpace::BLOCK_SELECTION,
+                               block_ids );
+    TEST_EQUALITY( block_space.selectionType(),
+                   FunctionSpace::BLOCK_SELECTION );
+    BlockPredicate block_predicate( block_ids );
+    FunctionSpace predicate_space( entity_set, Teuchos::null, Teuchos::null,
+                                   Teuchos::null,
+                                   block_predicate.getFunction() );
+    TEST_EQUALITY( predicate_space.selectionType(),
+                   FunctionSpace::PREDICATE_SELECTION );
+
+    // Both spaces select the same entities with and without a predicate.
+    PredicateFunction low_ids = []( Entity e ) { return ( e.id() < 5 ); };
+    Teuchos::Array<PredicateFunction> predicates( 2 );
+    predicates[1] = low_ids;
+    Teuchos::Array<std::size_t> num_selected( 2 );
+    num_selected[0] = num_boxes / 2;
+    num_selected[1] = 2;
+    for ( int p = 0; p < 2; ++p )
+    {
+        EntityIterator block_it =
+            block_space.selectedEntityIterator( 3, predicates[p] );
+        EntityIterator predicate_it =
+            predicate_space.selectedEntityIterator( 3, predicates[p] );
+        TEST_EQUALITY( block_it.size(), num_selected[p] );
+        TEST_EQUALITY( predicate_it.size(), num_selected[p] );
+        auto predicate_entity = predicate_it.begin();
+        for ( auto it = block_it.begin();
+              it != block_it.end() && predicate_entity != predicate_it.end();
+              ++it, ++predicate_entity )
+        {
+            TEST_EQUALITY( it->id(), predicate_entity->id() );
+            TEST_ASSERT( block_space.selectFunction()( *it ) );
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end tstBasicEntitySet.cpp
 //---------------------------------------------------------------------------//
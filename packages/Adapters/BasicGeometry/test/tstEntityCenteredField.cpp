@@ -135,6 +135,193 @@ TEUCHOS_UNIT_TEST( EntityCenteredField, vector_test )
     }
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( EntityCenteredField, bulk_test )
+{
+    // Initialize parallel communication.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+
+    // Field parameters.
+    int num_vec = 2;
+    int vec_length = 10;
+
+    // Create data in both layouts.
+    Teuchos::Array<double> coords( 1 );
+    Teuchos::Array<DataTransferKit::Entity> points( vec_length );
+    Teuchos::ArrayRCP<double> blocked_data( num_vec * vec_length );
+    Teuchos::ArrayRCP<double> interleaved_data( num_vec * vec_length );
+    for ( int i = 0; i < vec_length; ++i )
+    {
+        coords[0] = i;
+        points[i] = DataTransferKit::Point( i + 1, comm->getRank(), coords );
+        for ( int d = 0; d < num_vec; ++d )
+        {
+            blocked_data[d * vec_length + i] = 2.0 * i + d;
+            interleaved_data[i * num_vec + d] = 2.0 * i + d;
+        }
+    }
+
+    Teuchos::RCP<DataTransferKit::Field> blocked_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            points(), num_vec, blocked_data,
+            DataTransferKit::EntityCenteredField::BLOCKED ) );
+    Teuchos::RCP<DataTransferKit::Field> interleaved_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            points(), num_vec, interleaved_data,
+            DataTransferKit::EntityCenteredField::INTERLEAVED ) );
+
+    // Read using the field's own support ids.
+    Teuchos::ArrayView<const DataTransferKit::SupportId> own_ids =
+        blocked_field->getLocalSupportIds();
+    Teuchos::Array<double> values( vec_length );
+    for ( int d = 0; d < num_vec; ++d )
+    {
+        blocked_field->readFieldDataBulk( own_ids, d, values() );
+        for ( int i = 0; i < vec_length; ++i )
+            TEST_EQUALITY( values[i], 2.0 * i + d );
+    }
+
+    // Read using a separate, reversed id array.
+    Teuchos::Array<DataTransferKit::SupportId> ids( vec_length );
+    for ( int i = 0; i < vec_length; ++i )
+        ids[i] = vec_length - i;
+    for ( int d = 0; d < num_vec; ++d )
+    {
+        interleaved_field->readFieldDataBulk( ids(), d, values() );
+        for ( int i = 0; i < vec_length; ++i )
+            TEST_EQUALITY( values[i], 2.0 * ( vec_length - i - 1 ) + d );
+    }
+
+    // Write using both id arrays and check the underlying data.
+    for ( int i = 0; i < vec_length; ++i )
+        values[i] = -1.0 * i;
+    blocked_field->writeFieldDataBulk( own_ids, 1, values() );
+    interleaved_field->writeFieldDataBulk( ids(), 1, values() );
+    for ( int i = 0; i < vec_length; ++i )
+    {
+        TEST_EQUALITY( blocked_data[vec_length + i], -1.0 * i );
+        TEST_EQUALITY( blocked_data[i], 2.0 * i );
+        TEST_EQUALITY( interleaved_data[i * num_vec + 1],
+                       -1.0 * ( vec_length - i - 1 ) );
+        TEST_EQUALITY( interleaved_data[i * num_vec], 2.0 * i );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( EntityCenteredField, zero_copy_test )
+{
+    // Initialize parallel communication.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+
+    // Vector parameters.
+    int num_vec = 3;
+    int vec_length = 10;
+
+    // Create an entity set.
+    Teuchos::RCP<DataTransferKit::BasicEntitySet> entity_set =
+        Teuchos::rcp( new DataTransferKit::BasicEntitySet( comm, 1 ) );
+
+    // Create data.
+    Teuchos::Array<double> coords( 1 );
+    Teuchos::Array<DataTransferKit::Entity> points( vec_length );
+    Teuchos::ArrayRCP<double> blocked_data( num_vec * vec_length, 0.0 );
+    Teuchos::ArrayRCP<double> interleaved_data( num_vec * vec_length, 0.0 );
+    for ( int i = 0; i < vec_length; ++i )
+    {
+        coords[0] = i;
+        points[i] = DataTransferKit::Point( i + 1, comm->getRank(), coords );
+    }
+
+    // Interleaved data cannot be wrapped.
+    Teuchos::RCP<DataTransferKit::Field> interleaved_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            points(), num_vec, interleaved_data,
+            DataTransferKit::EntityCenteredField::INTERLEAVED ) );
+    DataTransferKit::FieldMultiVector interleaved_vec( interleaved_field,
+                                                       entity_set );
+    TEST_ASSERT( !interleaved_vec.isZeroCopy() );
+
+    // Blocked data is wrapped if the vector memory is host accessible.
+    Teuchos::RCP<DataTransferKit::Field> blocked_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            points(), num_vec, blocked_data,
+            DataTransferKit::EntityCenteredField::BLOCKED ) );
+    DataTransferKit::FieldMultiVector blocked_vec( blocked_field, entity_set );
+    if ( blocked_vec.isZeroCopy() )
+    {
+        // Writes into the vector land in the application data without a
+        // push.
+        blocked_vec.putScalar( 2.0 );
+        for ( int n = 0; n < num_vec * vec_length; ++n )
+        {
+            TEST_EQUALITY( blocked_data[n], 2.0 );
+        }
+
+        // Writes into the application data are seen by the vector without a
+        // pull.
+        blocked_data[vec_length + 3] = 5.0;
+        Teuchos::ArrayRCP<const double> column = blocked_vec.getData( 1 );
+        TEST_EQUALITY( column[3], 5.0 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( EntityCenteredField, large_copy_test )
+{
+    // Initialize parallel communication.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+
+    // Vector parameters. Use interleaved data large enough that the copies
+    // are split into blocks when threading is enabled.
+    int num_vec = 3;
+    int vec_length = 10000;
+
+    // Create an entity set.
+    Teuchos::RCP<DataTransferKit::BasicEntitySet> entity_set =
+        Teuchos::rcp( new DataTransferKit::BasicEntitySet( comm, 1 ) );
+
+    // Create data.
+    Teuchos::Array<double> coords( 1 );
+    Teuchos::Array<DataTransferKit::Entity> points( vec_length );
+    Teuchos::ArrayRCP<double> in_data( num_vec * vec_length );
+    Teuchos::ArrayRCP<double> out_data( num_vec * vec_length, 0.0 );
+    for ( int i = 0; i < vec_length; ++i )
+    {
+        coords[0] = i;
+        points[i] = DataTransferKit::Point( i + 1, comm->getRank(), coords );
+        for ( int d = 0; d < num_vec; ++d )
+        {
+            in_data[i * num_vec + d] = 2.0 * i + d;
+        }
+    }
+
+    // Create the vectors.
+    Teuchos::RCP<DataTransferKit::Field> in_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            points(), num_vec, in_data,
+            DataTransferKit::EntityCenteredField::INTERLEAVED ) );
+    DataTransferKit::FieldMultiVector in_vec( in_field, entity_set );
+    Teuchos::RCP<DataTransferKit::Field> out_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            points(), num_vec, out_data,
+            DataTransferKit::EntityCenteredField::INTERLEAVED ) );
+    DataTransferKit::FieldMultiVector out_vec( out_field, entity_set );
+
+    // Copy through the vectors.
+    in_vec.pullDataFromApplication();
+    out_vec.update( 1.0, in_vec, 0.0 );
+    out_vec.pushDataToApplication();
+
+    // Check the results.
+    for ( int n = 0; n < num_vec * vec_length; ++n )
+    {
+        TEST_EQUALITY( in_data[n], out_data[n] );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end of tstEntityCenteredField.cpp
 //---------------------------------------------------------------------------//
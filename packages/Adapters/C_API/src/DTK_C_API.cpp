@@ -233,6 +233,82 @@ void DTK_Map_apply( DTK_Map *dtk_map, double const *src_data,
                          transpose ? Teuchos::TRANS : Teuchos::NO_TRANS );
 }
 
+//----------------------------------------------------------------------------//
+void DTK_Map_apply_fields( DTK_Map *dtk_map, int num_fields,
+                           double const *const *src_fields,
+                           DTK_Data_layout src_layout,
+                           double *const *tgt_fields,
+                           DTK_Data_layout tgt_layout, int const *field_dims,
+                           bool transpose )
+{
+    // Cast the opaque pointer back to a DTK map operator
+    auto map_operator = static_cast<DataTransferKit::MapOperator *>( dtk_map );
+
+    // Helper function to get the index of a field component in a data layout
+    auto field_index = []( DTK_Data_layout data_layout, int num_entities,
+                           int field_dim, int entity, int component ) {
+        if ( data_layout == DTK_BLOCKED )
+            return component * num_entities + entity;
+        else if ( data_layout == DTK_INTERLEAVED )
+            return entity * field_dim + component;
+        else
+            throw std::runtime_error( "Invalid data layout" );
+    };
+
+    // Stack the fields into blocked buffers so all of them are moved with a
+    // single multivector apply.
+    auto domain_map = map_operator->getDomainMap();
+    auto range_map = map_operator->getRangeMap();
+    int src_num = domain_map->getNodeNumElements();
+    int tgt_num = range_map->getNodeNumElements();
+    int total_dim = 0;
+    for ( int f = 0; f < num_fields; ++f )
+        total_dim += field_dims[f];
+    Teuchos::ArrayRCP<double> src_data( total_dim * src_num );
+    Teuchos::ArrayRCP<double> tgt_data( total_dim * tgt_num );
+    for ( int f = 0, offset = 0; f < num_fields; offset += field_dims[f++] )
+    {
+        for ( int c = 0; c < field_dims[f]; ++c )
+        {
+            for ( int i = 0; i < src_num; ++i )
+                src_data[( offset + c ) * src_num + i] = src_fields[f][
+                    field_index( src_layout, src_num, field_dims[f], i, c )];
+            for ( int i = 0; i < tgt_num; ++i )
+                tgt_data[( offset + c ) * tgt_num + i] = tgt_fields[f][
+                    field_index( tgt_layout, tgt_num, field_dims[f], i, c )];
+        }
+    }
+
+    // Wrap the source and target buffers
+    DataTransferKit::EntityCenteredField src_field(
+        domain_map->getNodeElementList(), total_dim, src_data,
+        DataTransferKit::EntityCenteredField::BLOCKED );
+    DataTransferKit::FieldMultiVector domain_vector(
+        domain_map->getComm(), Teuchos::rcpFromRef( src_field ) );
+
+    DataTransferKit::EntityCenteredField tgt_field(
+        range_map->getNodeElementList(), total_dim, tgt_data,
+        DataTransferKit::EntityCenteredField::BLOCKED );
+    DataTransferKit::FieldMultiVector range_vector(
+        range_map->getComm(), Teuchos::rcpFromRef( tgt_field ) );
+
+    // Apply the map operator
+    map_operator->apply( domain_vector, range_vector,
+                         transpose ? Teuchos::TRANS : Teuchos::NO_TRANS );
+
+    // Copy the results back into the target fields
+    for ( int f = 0, offset = 0; f < num_fields; offset += field_dims[f++] )
+    {
+        for ( int c = 0; c < field_dims[f]; ++c )
+        {
+            for ( int i = 0; i < tgt_num; ++i )
+                tgt_fields[f][field_index( tgt_layout, tgt_num, field_dims[f],
+                                           i, c )] =
+                    tgt_data[( offset + c ) * tgt_num + i];
+        }
+    }
+}
+
 //----------------------------------------------------------------------------//
 void DTK_Map_delete( DTK_Map *dtk_map )
 {
@@ -71,6 +71,19 @@ void DTK_Map_apply( DTK_Map*        dtk_map,
                     int             field_dim,
                     bool            transpose );
 
+//----------------------------------------------------------------------------//
+// Apply the map to several fields at once. Field i has field_dims[i]
+// components stored in src_fields[i] and tgt_fields[i] with the given
+// layouts. All fields are moved with a single application of the map.
+void DTK_Map_apply_fields( DTK_Map*              dtk_map,
+                           int                   num_fields,
+                           double const* const*  src_fields,
+                           DTK_Data_layout       src_layout,
+                           double* const*        tgt_fields,
+                           DTK_Data_layout       tgt_layout,
+                           int const*            field_dims,
+                           bool                  transpose );
+
 //----------------------------------------------------------------------------//
 void DTK_Map_delete( DTK_Map * dtk_map );
 
@@ -180,6 +180,13 @@ std::unique_ptr<EntityIterator> POD_PointCloudEntityIterator::clone() const
         new POD_PointCloudEntityIterator( *this ) );
 }
 
+//---------------------------------------------------------------------------//
+// Determine if the iterator is at the end of the entities.
+bool POD_PointCloudEntityIterator::atEnd() const
+{
+    return ( d_current_lid == d_num_points );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -110,6 +110,9 @@ class POD_PointCloudEntityIterator : public EntityIterator
     // and assignment operator to pass along the underlying implementation.
     std::unique_ptr<EntityIterator> clone() const override;
 
+    // Determine if the iterator is at the end of the entities.
+    bool atEnd() const override;
+
   private:
     // Point cloud coordinates.
     const double *d_cloud_coords;
@@ -48,9 +48,30 @@ int main(int argc, char* argv[])
       tgt_field, DTK_INTERLEAVED,
       field_dim, false );
 
+  assert( tgt_field[0] == tgt_coord[1] );
+
+  double src_field_2[4];
+  src_field_2[0] = 2 * src_coord[1];
+  src_field_2[1] = 3 * src_coord[1];
+  src_field_2[2] = 2 * src_coord[3];
+  src_field_2[3] = 3 * src_coord[3];
+  double tgt_field_2[2] = { 255, 255 };
+  tgt_field[0] = 255;
+
+  double const* src_fields[2] = { src_field, src_field_2 };
+  double* tgt_fields[2] = { tgt_field, tgt_field_2 };
+  int field_dims[2] = { 1, 2 };
+
+  DTK_Map_apply_fields( dtk_map, 2,
+      src_fields, DTK_INTERLEAVED,
+      tgt_fields, DTK_INTERLEAVED,
+      field_dims, false );
+
   DTK_Map_delete( dtk_map );
 
   assert( tgt_field[0] == tgt_coord[1] );
+  assert( tgt_field_2[0] == 2 * tgt_coord[1] );
+  assert( tgt_field_2[1] == 3 * tgt_coord[1] );
 
   free(src_coord);
   free(src_field);
@@ -125,6 +125,16 @@ bool ClassicMeshElementLocalMap<Mesh>::isSafeToMapToReferenceFrame(
                                                         physical_point );
 }
 
+//---------------------------------------------------------------------------//
+// Perform a safeguard check with a precomputed entity bounding box.
+template <class Mesh>
+bool ClassicMeshElementLocalMap<Mesh>::isSafeToMapToReferenceFrame(
+    const Entity &entity, const Teuchos::Tuple<double, 6> &entity_box,
+    const Teuchos::ArrayView<const double> &physical_point ) const
+{
+    return this->pointInBoundingBox( entity, entity_box, physical_point );
+}
+
 //---------------------------------------------------------------------------//
 // Map a point to the reference space of an entity. Return the parameterized
 // point.
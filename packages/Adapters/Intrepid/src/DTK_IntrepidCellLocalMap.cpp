@@ -39,15 +39,243 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
 #include "DTK_IntrepidCellLocalMap.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_IntrepidCell.hpp"
 #include "DTK_ProjectionPrimitives.hpp"
 
+#include <Teuchos_Array.hpp>
+#include <Teuchos_as.hpp>
+
+#include <Shards_BasicTopologies.hpp>
+
+#include <Intrepid_CellTools.hpp>
 #include <Intrepid_FieldContainer.hpp>
 
 namespace DataTransferKit
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// Per-thread scratch space for the local map helpers. Constructing an
+// IntrepidCell builds a cubature rule so cells are kept by topology key.
+struct IntrepidCellWorkspace
+{
+    IntrepidCellWorkspace()
+        : point_dims( 2 )
+        , phys_dims( 3 )
+        , measure( 1 )
+    { /* ... */
+    }
+
+    // Cells with their cubature rules already built.
+    std::unordered_map<unsigned, Teuchos::RCP<IntrepidCell>> cells;
+
+    // Dimensions used to wrap single points (P,D).
+    Teuchos::Array<int> point_dims;
+
+    // Dimensions used to wrap points in the physical frame (C,P,D).
+    Teuchos::Array<int> phys_dims;
+
+    // Cell measure (C).
+    Intrepid::FieldContainer<double> measure;
+
+    // Reference cell center (P,D).
+    Intrepid::FieldContainer<double> ref_center;
+
+    // Physical cell center (C,P,D).
+    Intrepid::FieldContainer<double> phys_center;
+
+    // Affine map origins of a batch of cells (C*3).
+    Teuchos::Array<double> affine_origins;
+
+    // Affine map inverse Jacobians of a batch of cells (C*9).
+    Teuchos::Array<double> affine_inverses;
+
+    // Batch cells that are not affine and need a Newton solve.
+    Teuchos::Array<int> nonaffine_cells;
+
+    // Node coordinates of the non-affine cells (C,N,D).
+    Intrepid::FieldContainer<double> nonaffine_coords;
+
+    // Points and reference points of the non-affine cells (C,D).
+    Intrepid::FieldContainer<double> nonaffine_points;
+    Intrepid::FieldContainer<double> nonaffine_ref_points;
+};
+
+//---------------------------------------------------------------------------//
+// Get the workspace of the calling thread.
+IntrepidCellWorkspace &threadWorkspace()
+{
+    static thread_local IntrepidCellWorkspace workspace;
+    return workspace;
+}
+
+//---------------------------------------------------------------------------//
+// Get the cached cell for a topology, building it on first use.
+IntrepidCell &workspaceCell( IntrepidCellWorkspace &workspace,
+                             const shards::CellTopology &entity_topo )
+{
+    Teuchos::RCP<IntrepidCell> &cell = workspace.cells[entity_topo.getKey()];
+    if ( cell.is_null() )
+    {
+        cell = Teuchos::rcp( new IntrepidCell( entity_topo, 1 ) );
+    }
+    return *cell;
+}
+
+//---------------------------------------------------------------------------//
+// Compute the affine map x = origin + J * xi of a cell if its geometry is
+// affine: linear simplices and parallelogram/parallelepiped tensor cells. The
+// inverse Jacobian is written row-major with a stride of 3. Returns false if
+// the cell must be inverted with Newton's method.
+bool affineCellMap( const shards::CellTopology &entity_topo,
+                    const Intrepid::FieldContainer<double> &entity_coords,
+                    const int cell, double *origin, double *inv_jacobian )
+{
+    // Reference vertices of the Intrepid tensor cells. The first 4 vertices
+    // give the quadrilateral in the (xi,eta) plane.
+    static const double tensor_vertices[8][3] = {
+        {-1.0, -1.0, -1.0}, {1.0, -1.0, -1.0}, {1.0, 1.0, -1.0},
+        {-1.0, 1.0, -1.0},  {-1.0, -1.0, 1.0}, {1.0, -1.0, 1.0},
+        {1.0, 1.0, 1.0},    {-1.0, 1.0, 1.0}};
+
+    // Only cells whose reference and physical dimensions match.
+    int space_dim = entity_coords.dimension( 2 );
+    if ( space_dim != Teuchos::as<int>( entity_topo.getDimension() ) )
+    {
+        return false;
+    }
+
+    // Get the nodes spanning each reference axis. Simplices span [0,1] and
+    // tensor cells span [-1,1].
+    bool is_tensor = false;
+    int axis_nodes[3] = {1, 2, 3};
+    switch ( entity_topo.getKey() )
+    {
+    case shards::Triangle<3>::key:
+    case shards::Tetrahedron<4>::key:
+        break;
+    case shards::Quadrilateral<4>::key:
+    case shards::Hexahedron<8>::key:
+        is_tensor = true;
+        axis_nodes[1] = 3;
+        axis_nodes[2] = 4;
+        break;
+    default:
+        return false;
+    }
+    double axis_scale = is_tensor ? 0.5 : 1.0;
+
+    // Build the Jacobian and the physical location of the reference origin.
+    double jacobian[9];
+    double length = 0.0;
+    for ( int i = 0; i < space_dim; ++i )
+    {
+        origin[i] = entity_coords( cell, 0, i );
+        for ( int j = 0; j < space_dim; ++j )
+        {
+            jacobian[3 * i + j] =
+                axis_scale * ( entity_coords( cell, axis_nodes[j], i ) -
+                               entity_coords( cell, 0, i ) );
+            length = std::max( length, std::abs( jacobian[3 * i + j] ) );
+            if ( is_tensor )
+            {
+                origin[i] += jacobian[3 * i + j];
+            }
+        }
+    }
+
+    // Tensor cells are only affine if every node is where the map puts it.
+    if ( is_tensor )
+    {
+        double tolerance = 1.0e-10 * length;
+        int num_nodes = entity_coords.dimension( 1 );
+        for ( int n = 0; n < num_nodes; ++n )
+        {
+            for ( int i = 0; i < space_dim; ++i )
+            {
+                double x = origin[i];
+                for ( int j = 0; j < space_dim; ++j )
+                {
+                    x += jacobian[3 * i + j] * tensor_vertices[n][j];
+                }
+                if ( std::abs( x - entity_coords( cell, n, i ) ) > tolerance )
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Invert the Jacobian.
+    const double *a = jacobian;
+    double *b = inv_jacobian;
+    if ( 3 == space_dim )
+    {
+        b[0] = a[4] * a[8] - a[5] * a[7];
+        b[1] = a[2] * a[7] - a[1] * a[8];
+        b[2] = a[1] * a[5] - a[2] * a[4];
+        b[3] = a[5] * a[6] - a[3] * a[8];
+        b[4] = a[0] * a[8] - a[2] * a[6];
+        b[5] = a[2] * a[3] - a[0] * a[5];
+        b[6] = a[3] * a[7] - a[4] * a[6];
+        b[7] = a[1] * a[6] - a[0] * a[7];
+        b[8] = a[0] * a[4] - a[1] * a[3];
+        double det = a[0] * b[0] + a[1] * b[3] + a[2] * b[6];
+        if ( std::abs( det ) <= 1.0e-14 * length * length * length )
+        {
+            return false;
+        }
+        for ( int k = 0; k < 9; ++k )
+        {
+            b[k] /= det;
+        }
+    }
+    else if ( 2 == space_dim )
+    {
+        double det = a[0] * a[4] - a[1] * a[3];
+        if ( std::abs( det ) <= 1.0e-14 * length * length )
+        {
+            return false;
+        }
+        b[0] = a[4] / det;
+        b[1] = -a[1] / det;
+        b[3] = -a[3] / det;
+        b[4] = a[0] / det;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Apply an inverse affine map: xi = J^{-1} * (x - origin).
+inline void applyAffineInverse( const double *origin,
+                                const double *inv_jacobian, const double *x,
+                                const int space_dim, double *xi )
+{
+    for ( int i = 0; i < space_dim; ++i )
+    {
+        xi[i] = 0.0;
+        for ( int j = 0; j < space_dim; ++j )
+        {
+            xi[i] += inv_jacobian[3 * i + j] * ( x[j] - origin[j] );
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // end anonymous namespace
+
 //---------------------------------------------------------------------------//
 // Return the entity measure with respect to the parameteric dimension (volume
 // for a 3D entity, area for 2D, and length for 1D).
@@ -56,15 +284,15 @@ double IntrepidCellLocalMap::measure(
     const Intrepid::FieldContainer<double> &entity_coords )
 {
     // Get the Intrepid cell corresponding to the entity topology.
-    IntrepidCell entity_cell( entity_topo, 1 );
+    IntrepidCellWorkspace &workspace = threadWorkspace();
+    IntrepidCell &entity_cell = workspaceCell( workspace, entity_topo );
 
     // Update thet state of the cell.
     IntrepidCell::updateState( entity_cell, entity_coords );
 
     // Compute the measure of the cell.
-    Intrepid::FieldContainer<double> measure( 1 );
-    entity_cell.getCellMeasures( measure );
-    return measure( 0 );
+    entity_cell.getCellMeasures( workspace.measure );
+    return workspace.measure( 0 );
 }
 
 //---------------------------------------------------------------------------//
@@ -75,21 +303,26 @@ void IntrepidCellLocalMap::centroid(
     const Teuchos::ArrayView<double> &centroid )
 {
     // Get the Intrepid cell corresponding to the entity topology.
-    IntrepidCell entity_cell( entity_topo, 1 );
+    IntrepidCellWorkspace &workspace = threadWorkspace();
+    IntrepidCell &entity_cell = workspaceCell( workspace, entity_topo );
     entity_cell.setCellNodeCoordinates( entity_coords );
 
     // Get the reference center of the cell.
-    Intrepid::FieldContainer<double> ref_center( 1,
-                                                 entity_coords.dimension( 2 ) );
-    ProjectionPrimitives::referenceCellCenter( entity_topo, ref_center );
+    int space_dim = entity_coords.dimension( 2 );
+    if ( workspace.ref_center.size() != space_dim )
+    {
+        workspace.ref_center.resize( 1, space_dim );
+        workspace.phys_center.resize( 1, 1, space_dim );
+    }
+    ProjectionPrimitives::referenceCellCenter( entity_topo,
+                                               workspace.ref_center );
 
     // Map the cell center to the physical frame.
-    Intrepid::FieldContainer<double> phys_center(
-        1, 1, entity_coords.dimension( 2 ) );
-    entity_cell.mapToCellPhysicalFrame( ref_center, phys_center );
+    entity_cell.mapToCellPhysicalFrame( workspace.ref_center,
+                                        workspace.phys_center );
 
     // Extract the centroid coordinates.
-    centroid.assign( phys_center.getData()() );
+    centroid.assign( workspace.phys_center.getData()() );
 }
 
 //---------------------------------------------------------------------------//
@@ -101,18 +334,29 @@ bool IntrepidCellLocalMap::mapToReferenceFrame(
     const Teuchos::ArrayView<const double> &point,
     const Teuchos::ArrayView<double> &reference_point )
 {
+    // Affine cells are inverted directly.
+    double origin[3];
+    double inv_jacobian[9];
+    if ( affineCellMap( entity_topo, entity_coords, 0, origin, inv_jacobian ) )
+    {
+        applyAffineInverse( origin, inv_jacobian, point.getRawPtr(),
+                            entity_coords.dimension( 2 ),
+                            reference_point.getRawPtr() );
+        return true;
+    }
+
     // Get the Intrepid cell corresponding to the entity topology.
-    IntrepidCell entity_cell( entity_topo, 1 );
+    IntrepidCellWorkspace &workspace = threadWorkspace();
+    IntrepidCell &entity_cell = workspaceCell( workspace, entity_topo );
     entity_cell.setCellNodeCoordinates( entity_coords );
 
     // Map the point to the reference frame of the cell.
-    Teuchos::Array<int> array_dims( 2 );
-    array_dims[0] = 1;
-    array_dims[1] = entity_coords.dimension( 2 );
+    workspace.point_dims[0] = 1;
+    workspace.point_dims[1] = entity_coords.dimension( 2 );
     Intrepid::FieldContainer<double> point_container(
-        array_dims, const_cast<double *>( point.getRawPtr() ) );
+        workspace.point_dims, const_cast<double *>( point.getRawPtr() ) );
     Intrepid::FieldContainer<double> ref_point_container(
-        array_dims, reference_point.getRawPtr() );
+        workspace.point_dims, reference_point.getRawPtr() );
     entity_cell.mapToCellReferenceFrame( point_container, ref_point_container );
 
     // Return true to indicate successful mapping. Catching Intrepid errors
@@ -120,6 +364,109 @@ bool IntrepidCellLocalMap::mapToReferenceFrame(
     return true;
 }
 
+//---------------------------------------------------------------------------//
+// Map a set of points to the reference space of a set of entities with the
+// same topology.
+void IntrepidCellLocalMap::mapToReferenceFrame(
+    const shards::CellTopology &entity_topo,
+    const Intrepid::FieldContainer<double> &entity_coords,
+    const Intrepid::FieldContainer<double> &points,
+    Intrepid::FieldContainer<double> &reference_points )
+{
+    DTK_REQUIRE( 3 == entity_coords.rank() );
+    DTK_REQUIRE( 2 == points.rank() );
+    DTK_REQUIRE( 2 == reference_points.rank() );
+    DTK_REQUIRE( points.dimension( 0 ) == entity_coords.dimension( 0 ) );
+    DTK_REQUIRE( points.dimension( 1 ) == entity_coords.dimension( 2 ) );
+    DTK_REQUIRE( reference_points.dimension( 0 ) == points.dimension( 0 ) );
+    DTK_REQUIRE( reference_points.dimension( 1 ) == points.dimension( 1 ) );
+
+    int num_cells = points.dimension( 0 );
+    if ( 0 == num_cells )
+    {
+        return;
+    }
+
+    // Compute the affine maps of the cells up front so that the affine cells
+    // are inverted with a single pass over contiguous arrays.
+    IntrepidCellWorkspace &workspace = threadWorkspace();
+    int space_dim = points.dimension( 1 );
+    workspace.affine_origins.resize( 3 * num_cells );
+    workspace.affine_inverses.resize( 9 * num_cells );
+    workspace.nonaffine_cells.clear();
+    for ( int c = 0; c < num_cells; ++c )
+    {
+        if ( !affineCellMap( entity_topo, entity_coords, c,
+                             &workspace.affine_origins[3 * c],
+                             &workspace.affine_inverses[9 * c] ) )
+        {
+            // Zero the map so the affine pass below stays branch-free. The
+            // result is overwritten by the Newton solve.
+            std::fill_n( &workspace.affine_origins[3 * c], 3, 0.0 );
+            std::fill_n( &workspace.affine_inverses[9 * c], 9, 0.0 );
+            workspace.nonaffine_cells.push_back( c );
+        }
+    }
+
+    const double *point_data = points.getData().getRawPtr();
+    double *ref_point_data = reference_points.getData().getRawPtr();
+    for ( int c = 0; c < num_cells; ++c )
+    {
+        applyAffineInverse( &workspace.affine_origins[3 * c],
+                            &workspace.affine_inverses[9 * c],
+                            point_data + space_dim * c, space_dim,
+                            ref_point_data + space_dim * c );
+    }
+
+    // Gather the non-affine cells and invert them with Newton's method.
+    int num_nonaffine = workspace.nonaffine_cells.size();
+    if ( 0 == num_nonaffine )
+    {
+        return;
+    }
+    int num_nodes = entity_coords.dimension( 1 );
+    workspace.nonaffine_coords.resize( num_nonaffine, num_nodes, space_dim );
+    workspace.nonaffine_points.resize( num_nonaffine, space_dim );
+    workspace.nonaffine_ref_points.resize( num_nonaffine, space_dim );
+    for ( int k = 0; k < num_nonaffine; ++k )
+    {
+        int c = workspace.nonaffine_cells[k];
+        for ( int d = 0; d < space_dim; ++d )
+        {
+            for ( int n = 0; n < num_nodes; ++n )
+            {
+                workspace.nonaffine_coords( k, n, d ) =
+                    entity_coords( c, n, d );
+            }
+            workspace.nonaffine_points( k, d ) = points( c, d );
+        }
+    }
+
+    // View the points as one point per cell (C,1,D) so that Intrepid inverts
+    // every cell in a single call.
+    workspace.phys_dims[0] = num_nonaffine;
+    workspace.phys_dims[1] = 1;
+    workspace.phys_dims[2] = space_dim;
+    Intrepid::FieldContainer<double> point_container(
+        workspace.phys_dims, workspace.nonaffine_points.getData().getRawPtr() );
+    Intrepid::FieldContainer<double> ref_point_container(
+        workspace.phys_dims,
+        workspace.nonaffine_ref_points.getData().getRawPtr() );
+    Intrepid::CellTools<double>::mapToReferenceFrame(
+        ref_point_container, point_container, workspace.nonaffine_coords,
+        entity_topo );
+
+    // Scatter the results.
+    for ( int k = 0; k < num_nonaffine; ++k )
+    {
+        int c = workspace.nonaffine_cells[k];
+        for ( int d = 0; d < space_dim; ++d )
+        {
+            reference_points( c, d ) = workspace.nonaffine_ref_points( k, d );
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Determine if a reference point is in the parameterized space of an entity.
 bool IntrepidCellLocalMap::checkPointInclusion(
@@ -128,14 +475,15 @@ bool IntrepidCellLocalMap::checkPointInclusion(
     const double tolerance )
 {
     // Get the Intrepid cell corresponding to the entity topology.
-    IntrepidCell entity_cell( entity_topo, 1 );
+    IntrepidCellWorkspace &workspace = threadWorkspace();
+    IntrepidCell &entity_cell = workspaceCell( workspace, entity_topo );
 
     // Check point inclusion.
-    Teuchos::Array<int> array_dims( 2 );
-    array_dims[0] = 1;
-    array_dims[1] = reference_point.size();
+    workspace.point_dims[0] = 1;
+    workspace.point_dims[1] = reference_point.size();
     Intrepid::FieldContainer<double> ref_point_container(
-        array_dims, const_cast<double *>( reference_point.getRawPtr() ) );
+        workspace.point_dims,
+        const_cast<double *>( reference_point.getRawPtr() ) );
     return entity_cell.pointInReferenceCell( ref_point_container, tolerance );
 }
 
@@ -148,20 +496,20 @@ void IntrepidCellLocalMap::mapToPhysicalFrame(
     const Teuchos::ArrayView<double> &point )
 {
     // Get the Intrepid cell corresponding to the entity topology.
-    IntrepidCell entity_cell( entity_topo, 1 );
+    IntrepidCellWorkspace &workspace = threadWorkspace();
+    IntrepidCell &entity_cell = workspaceCell( workspace, entity_topo );
     entity_cell.setCellNodeCoordinates( entity_coords );
 
     // Map the reference point to the physical frame of the cell.
-    Teuchos::Array<int> ref_array_dims( 2 );
-    ref_array_dims[0] = 1;
-    ref_array_dims[1] = entity_coords.dimension( 2 );
+    workspace.point_dims[0] = 1;
+    workspace.point_dims[1] = entity_coords.dimension( 2 );
     Intrepid::FieldContainer<double> ref_point_container(
-        ref_array_dims, const_cast<double *>( reference_point.getRawPtr() ) );
-    Teuchos::Array<int> phys_array_dims( 3 );
-    phys_array_dims[0] = 1;
-    phys_array_dims[1] = 1;
-    phys_array_dims[2] = entity_coords.dimension( 2 );
-    Intrepid::FieldContainer<double> point_container( phys_array_dims,
+        workspace.point_dims,
+        const_cast<double *>( reference_point.getRawPtr() ) );
+    workspace.phys_dims[0] = 1;
+    workspace.phys_dims[1] = 1;
+    workspace.phys_dims[2] = entity_coords.dimension( 2 );
+    Intrepid::FieldContainer<double> point_container( workspace.phys_dims,
                                                       point.getRawPtr() );
     entity_cell.mapToCellPhysicalFrame( ref_point_container, point_container );
 }
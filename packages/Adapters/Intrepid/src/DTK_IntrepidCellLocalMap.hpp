@@ -56,6 +56,10 @@ namespace DataTransferKit
   \class IntrepidcellLocalMap
   \brief A stateless class of IntrepidCell helpers for implementing
   EntityLocalMap for element-level entities.
+
+  Each thread keeps a workspace of IntrepidCell objects keyed by topology and
+  the scratch containers used by these helpers so repeated calls from the fine
+  search do not rebuild cubature rules or reallocate containers.
 */
 //---------------------------------------------------------------------------//
 class IntrepidCellLocalMap
@@ -99,6 +103,22 @@ class IntrepidCellLocalMap
                          const Teuchos::ArrayView<const double> &point,
                          const Teuchos::ArrayView<double> &reference_point );
 
+    /*!
+     * \brief (Batched Reverse Map) Map a set of points to the reference space
+     * of a set of entities with the same topology. Point c is mapped into
+     * entity c.
+     * \param entity_topo The topology shared by all entities.
+     * \param entity_coords The node coordinates of the entities (C,N,D).
+     * \param points The physical coordinates of the points to map (C,D).
+     * \param reference_points The reference coordinates of the mapped points
+     * (C,D). This container must already be allocated.
+     */
+    static void
+    mapToReferenceFrame( const shards::CellTopology &entity_topo,
+                         const Intrepid::FieldContainer<double> &entity_coords,
+                         const Intrepid::FieldContainer<double> &points,
+                         Intrepid::FieldContainer<double> &reference_points );
+
     /*!
      * \brief Determine if a reference point is in the parameterized space of
      * an entity.
@@ -225,6 +225,160 @@ TEUCHOS_UNIT_TEST( IntrepidCellLocalMap, element_single_cell_test )
     }
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( IntrepidCellLocalMap, element_batch_test )
+{
+    // Basic problem info.
+    int dimension = 3;
+    int num_elements = 5;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = getDefaultComm<int>();
+
+    // Build the mesh
+    Teuchos::Array<double> element_coordinates =
+        buildMeshNodeCoordinates( comm, dimension, num_elements );
+
+    // Create a cell topology.
+    shards::CellTopology element_topo =
+        shards::getCellTopologyData<shards::Hexahedron<8>>();
+
+    // Map one point into each element in a single call.
+    int num_nodes = element_topo.getNodeCount();
+    Teuchos::Array<int> coord_dims( 3 );
+    coord_dims[0] = num_elements;
+    coord_dims[1] = num_nodes;
+    coord_dims[2] = dimension;
+    Intrepid::FieldContainer<double> element_coords( coord_dims,
+                                                     element_coordinates() );
+    Intrepid::FieldContainer<double> points( num_elements, dimension );
+    for ( int cell = 0; cell < num_elements; ++cell )
+    {
+        points( cell, 0 ) = 1.0 * ( cell ) + 0.5;
+        points( cell, 1 ) = 0.5;
+        points( cell, 2 ) = 1.5;
+    }
+    Intrepid::FieldContainer<double> param_coords( num_elements, dimension );
+    DataTransferKit::IntrepidCellLocalMap::mapToReferenceFrame(
+        element_topo, element_coords, points, param_coords );
+
+    // Check against the single cell map.
+    Teuchos::Array<double> coords( dimension );
+    Teuchos::Array<double> single_param_coords( dimension );
+    coord_dims[0] = 1;
+    for ( int cell = 0; cell < num_elements; ++cell )
+    {
+        Intrepid::FieldContainer<double> single_coords(
+            coord_dims, element_coordinates( num_nodes * cell * dimension,
+                                             dimension * num_nodes ) );
+        for ( int d = 0; d < dimension; ++d )
+        {
+            coords[d] = points( cell, d );
+        }
+        DataTransferKit::IntrepidCellLocalMap::mapToReferenceFrame(
+            element_topo, single_coords, coords, single_param_coords );
+        for ( int d = 0; d < dimension; ++d )
+        {
+            TEST_ASSERT( std::abs( param_coords( cell, d ) -
+                                   single_param_coords[d] ) < 1.0e-12 );
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( IntrepidCellLocalMap, affine_test )
+{
+    int dimension = 3;
+
+    // Create a linear tet with its first node at (1,0,0) and edges of length
+    // 2, 4, and 5 along the axes.
+    shards::CellTopology tet_topo =
+        shards::getCellTopologyData<shards::Tetrahedron<4>>();
+    Intrepid::FieldContainer<double> tet_coords( 1, 4, dimension );
+    tet_coords.initialize( 0.0 );
+    tet_coords( 0, 0, 0 ) = 1.0;
+    tet_coords( 0, 1, 0 ) = 3.0;
+    tet_coords( 0, 2, 0 ) = 1.0;
+    tet_coords( 0, 2, 1 ) = 4.0;
+    tet_coords( 0, 3, 0 ) = 1.0;
+    tet_coords( 0, 3, 2 ) = 5.0;
+
+    // The tet inverse is closed form.
+    Teuchos::Array<double> point( dimension );
+    point[0] = 1.5;
+    point[1] = 1.0;
+    point[2] = 2.5;
+    Teuchos::Array<double> ref_point( dimension );
+    DataTransferKit::IntrepidCellLocalMap::mapToReferenceFrame(
+        tet_topo, tet_coords, point(), ref_point() );
+    TEST_FLOATING_EQUALITY( ref_point[0], 0.25, 1.0e-14 );
+    TEST_FLOATING_EQUALITY( ref_point[1], 0.25, 1.0e-14 );
+    TEST_FLOATING_EQUALITY( ref_point[2], 0.5, 1.0e-14 );
+    TEST_ASSERT( DataTransferKit::IntrepidCellLocalMap::checkPointInclusion(
+        tet_topo, ref_point(), 1.0e-6 ) );
+
+    // Create a batch of two hexes. The first is a parallelepiped and the
+    // second has a displaced node and needs a Newton solve.
+    shards::CellTopology hex_topo =
+        shards::getCellTopologyData<shards::Hexahedron<8>>();
+    int num_nodes = hex_topo.getNodeCount();
+    double ref_vertices[8][3] = {{-1.0, -1.0, -1.0}, {1.0, -1.0, -1.0},
+                                 {1.0, 1.0, -1.0},   {-1.0, 1.0, -1.0},
+                                 {-1.0, -1.0, 1.0},  {1.0, -1.0, 1.0},
+                                 {1.0, 1.0, 1.0},    {-1.0, 1.0, 1.0}};
+    Intrepid::FieldContainer<double> hex_coords( 2, num_nodes, dimension );
+    for ( int c = 0; c < 2; ++c )
+    {
+        for ( int n = 0; n < num_nodes; ++n )
+        {
+            // Sheared map x = (1 + xi + 0.5 * eta, 2 * eta, 3 * zeta).
+            hex_coords( c, n, 0 ) =
+                1.0 + ref_vertices[n][0] + 0.5 * ref_vertices[n][1];
+            hex_coords( c, n, 1 ) = 2.0 * ref_vertices[n][1];
+            hex_coords( c, n, 2 ) = 3.0 * ref_vertices[n][2];
+        }
+    }
+    hex_coords( 1, 6, 0 ) += 0.25;
+
+    Intrepid::FieldContainer<double> points( 2, dimension );
+    for ( int c = 0; c < 2; ++c )
+    {
+        points( c, 0 ) = 1.25;
+        points( c, 1 ) = 0.5;
+        points( c, 2 ) = -1.5;
+    }
+    Intrepid::FieldContainer<double> ref_points( 2, dimension );
+    DataTransferKit::IntrepidCellLocalMap::mapToReferenceFrame(
+        hex_topo, hex_coords, points, ref_points );
+
+    // The parallelepiped inverse is exact.
+    TEST_FLOATING_EQUALITY( ref_points( 0, 0 ), 0.125, 1.0e-14 );
+    TEST_FLOATING_EQUALITY( ref_points( 0, 1 ), 0.25, 1.0e-14 );
+    TEST_FLOATING_EQUALITY( ref_points( 0, 2 ), -0.5, 1.0e-14 );
+
+    // The distorted hex must map back to the original point.
+    Teuchos::Array<int> coord_dims( 3 );
+    coord_dims[0] = 1;
+    coord_dims[1] = num_nodes;
+    coord_dims[2] = dimension;
+    Intrepid::FieldContainer<double> distorted_coords(
+        coord_dims, hex_coords.getData()( num_nodes * dimension,
+                                          num_nodes * dimension ) );
+    Teuchos::Array<double> distorted_ref( dimension );
+    Teuchos::Array<double> distorted_point( dimension );
+    for ( int d = 0; d < dimension; ++d )
+    {
+        distorted_ref[d] = ref_points( 1, d );
+    }
+    DataTransferKit::IntrepidCellLocalMap::mapToPhysicalFrame(
+        hex_topo, distorted_coords, distorted_ref(), distorted_point() );
+    for ( int d = 0; d < dimension; ++d )
+    {
+        TEST_ASSERT( std::abs( distorted_point[d] - points( 1, d ) ) <
+                     1.0e-8 );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end tstIntrepidCellLocalMap.cpp
 //---------------------------------------------------------------------------//
@@ -121,6 +121,18 @@ void LibmeshEntityLocalMap::centroid(
 bool LibmeshEntityLocalMap::isSafeToMapToReferenceFrame(
     const DataTransferKit::Entity &entity,
     const Teuchos::ArrayView<const double> &physical_point ) const
+{
+    Teuchos::Tuple<double, 6> entity_box;
+    entity.boundingBox( entity_box );
+    return isSafeToMapToReferenceFrame( entity, entity_box, physical_point );
+}
+
+//---------------------------------------------------------------------------//
+// Perform a safeguard check with a precomputed entity bounding box.
+bool LibmeshEntityLocalMap::isSafeToMapToReferenceFrame(
+    const DataTransferKit::Entity &entity,
+    const Teuchos::Tuple<double, 6> &entity_box,
+    const Teuchos::ArrayView<const double> &physical_point ) const
 {
     int space_dim = entity.physicalDimension();
     int param_dim = 0;
@@ -137,8 +149,7 @@ bool LibmeshEntityLocalMap::isSafeToMapToReferenceFrame(
     if ( space_dim == param_dim )
     {
         // See if we are in the Cartesian bounding box.
-        if ( EntityLocalMap::isSafeToMapToReferenceFrame( entity,
-                                                          physical_point ) )
+        if ( pointInBoundingBox( entity, entity_box, physical_point ) )
         {
             // If we are in the Cartesian bounding box see if we are 'close'
             // to the element according to libMesh.
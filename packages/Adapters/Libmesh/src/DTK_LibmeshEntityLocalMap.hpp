@@ -106,6 +106,20 @@ class LibmeshEntityLocalMap : public DataTransferKit::EntityLocalMap
         const DataTransferKit::Entity &entity,
         const Teuchos::ArrayView<const double> &physical_point ) const override;
 
+    /*!
+     * \brief (Safeguard the reverse map) Perform the safeguard check with a
+     * precomputed bounding box of the entity.
+     * \param entity Perfrom the mapping for this entity.
+     * \param entity_box The bounding box of the entity.
+     * \param physical_point A view into an array of size physicalDimension()
+     * containing the coordinates of the point to map.
+     * \return Return true if it is safe to map to the reference frame.
+     */
+    bool isSafeToMapToReferenceFrame(
+        const DataTransferKit::Entity &entity,
+        const Teuchos::Tuple<double, 6> &entity_box,
+        const Teuchos::ArrayView<const double> &physical_point ) const override;
+
     /*!
      * \brief (Reverse Map) Map a point to the reference space of an
      * entity. Return the parameterized point.
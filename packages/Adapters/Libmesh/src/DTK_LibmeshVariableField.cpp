@@ -38,6 +38,7 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
 #include <cassert>
 #include <unordered_map>
 
@@ -126,6 +127,64 @@ void LibmeshVariableField::writeFieldData( const SupportId support_id,
     }
 }
 
+//---------------------------------------------------------------------------//
+// Given a set of local support ids and a dimension, read data from the
+// application field.
+void LibmeshVariableField::readFieldDataBulk(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int dimension, const Teuchos::ArrayView<double> &data ) const
+{
+    DTK_REQUIRE( 0 == dimension );
+    DTK_REQUIRE( support_ids.size() == data.size() );
+    std::vector<libMesh::dof_id_type> dof_ids;
+    getDofIds( support_ids, dof_ids );
+    std::vector<libMesh::Number> values;
+    d_libmesh_system->current_local_solution->get( dof_ids, values );
+    std::copy( values.begin(), values.end(), data.begin() );
+}
+
+//---------------------------------------------------------------------------//
+// Given a set of local support ids, dimension, and field values, write data
+// into the application field. Only the locally-owned nodes are written.
+void LibmeshVariableField::writeFieldDataBulk(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int dimension, const Teuchos::ArrayView<const double> &data )
+{
+    DTK_REQUIRE( 0 == dimension );
+    DTK_REQUIRE( support_ids.size() == data.size() );
+    std::vector<libMesh::dof_id_type> dof_ids;
+    std::vector<libMesh::Number> values;
+    int num_ids = support_ids.size();
+    for ( int n = 0; n < num_ids; ++n )
+    {
+        const libMesh::Node &node = d_libmesh_mesh->node( support_ids[n] );
+        DTK_CHECK( 1 == node.n_comp( d_system_id, d_variable_id ) );
+        if ( node.processor_id() == d_libmesh_system->processor_id() )
+        {
+            dof_ids.push_back(
+                node.dof_number( d_system_id, d_variable_id, 0 ) );
+            values.push_back( data[n] );
+        }
+    }
+    d_libmesh_system->solution->insert( values, dof_ids );
+}
+
+//---------------------------------------------------------------------------//
+// Get the degrees of freedom of the given support ids.
+void LibmeshVariableField::getDofIds(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    std::vector<libMesh::dof_id_type> &dof_ids ) const
+{
+    int num_ids = support_ids.size();
+    dof_ids.resize( num_ids );
+    for ( int n = 0; n < num_ids; ++n )
+    {
+        const libMesh::Node &node = d_libmesh_mesh->node( support_ids[n] );
+        DTK_CHECK( 1 == node.n_comp( d_system_id, d_variable_id ) );
+        dof_ids[n] = node.dof_number( d_system_id, d_variable_id, 0 );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Finalize after writing.
 void LibmeshVariableField::finalizeAfterWrite()
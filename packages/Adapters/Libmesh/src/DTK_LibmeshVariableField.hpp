@@ -43,6 +43,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <DTK_Field.hpp>
 #include <DTK_Types.hpp>
@@ -101,12 +102,35 @@ class LibmeshVariableField : public Field
     void writeFieldData( const SupportId support_id, const int dimension,
                          const double data ) override;
 
+    /*!
+     * \brief Given a set of local support ids and a dimension, read data from
+     * the application field.
+     */
+    void
+    readFieldDataBulk( const Teuchos::ArrayView<const SupportId> &support_ids,
+                       const int dimension,
+                       const Teuchos::ArrayView<double> &data ) const override;
+
+    /*!
+     * \brief Given a set of local support ids, dimension, and field values,
+     * write data into the application field.
+     */
+    void writeFieldDataBulk(
+        const Teuchos::ArrayView<const SupportId> &support_ids,
+        const int dimension,
+        const Teuchos::ArrayView<const double> &data ) override;
+
     /*!
      * \brief Finalize writing of field data to a field. This lets some
      * clients do a write post-process (e.g. update ghost values).
      */
     void finalizeAfterWrite() override;
 
+  private:
+    // Get the degrees of freedom of the given support ids.
+    void getDofIds( const Teuchos::ArrayView<const SupportId> &support_ids,
+                    std::vector<libMesh::dof_id_type> &dof_ids ) const;
+
   private:
     // Libmesh mesh.
     Teuchos::RCP<libMesh::MeshBase> d_libmesh_mesh;
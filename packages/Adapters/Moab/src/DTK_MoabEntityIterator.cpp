@@ -166,6 +166,13 @@ std::unique_ptr<EntityIterator> MoabEntityIterator::clone() const
     return std::unique_ptr<EntityIterator>( new MoabEntityIterator( *this ) );
 }
 
+//---------------------------------------------------------------------------//
+// Determine if the iterator is at the end of the entities.
+bool MoabEntityIterator::atEnd() const
+{
+    return ( d_moab_entity_it == d_entity_range->d_moab_entities.end() );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
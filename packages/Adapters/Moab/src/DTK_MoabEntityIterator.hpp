@@ -114,6 +114,9 @@ class MoabEntityIterator : public EntityIterator
     // and assignment operator to pass along the underlying implementation.
     std::unique_ptr<EntityIterator> clone() const override;
 
+    // Determine if the iterator is at the end of the entities.
+    bool atEnd() const override;
+
   private:
     // Range of entities over which the iterator is defined.
     Teuchos::RCP<MoabEntityIteratorRange> d_entity_range;
@@ -113,14 +113,24 @@ void MoabEntityLocalMap::centroid(
 bool MoabEntityLocalMap::isSafeToMapToReferenceFrame(
     const Entity &entity,
     const Teuchos::ArrayView<const double> &physical_point ) const
+{
+    Teuchos::Tuple<double, 6> entity_box;
+    entity.boundingBox( entity_box );
+    return isSafeToMapToReferenceFrame( entity, entity_box, physical_point );
+}
+
+//---------------------------------------------------------------------------//
+// Perform a safeguard check with a precomputed entity bounding box.
+bool MoabEntityLocalMap::isSafeToMapToReferenceFrame(
+    const Entity &entity, const Teuchos::Tuple<double, 6> &entity_box,
+    const Teuchos::ArrayView<const double> &physical_point ) const
 {
     int space_dim = entity.physicalDimension();
     int param_dim = d_moab_mesh->get_moab()->dimension_from_handle(
         MoabHelpers::extractEntity( entity ) );
     if ( space_dim == param_dim )
     {
-        return EntityLocalMap::isSafeToMapToReferenceFrame( entity,
-                                                            physical_point );
+        return pointInBoundingBox( entity, entity_box, physical_point );
     }
     else
     {
@@ -116,6 +116,26 @@ MoabEntitySet::entityIterator( const int topological_dimension,
                                d_set_indexer.ptr(), predicate );
 }
 
+//---------------------------------------------------------------------------//
+// Get an iterator over the entities of the given type in any of the given
+// blocks.
+EntityIterator
+MoabEntitySet::blockEntityIterator( const int topological_dimension,
+                                    const Teuchos::Array<int> &block_ids ) const
+{
+    return meshSetEntityIterator( topological_dimension, block_ids );
+}
+
+//---------------------------------------------------------------------------//
+// Get an iterator over the entities of the given type on any of the given
+// boundaries.
+EntityIterator MoabEntitySet::boundaryEntityIterator(
+    const int topological_dimension,
+    const Teuchos::Array<int> &boundary_ids ) const
+{
+    return meshSetEntityIterator( topological_dimension, boundary_ids );
+}
+
 //---------------------------------------------------------------------------//
 // Given an entity, get the entities of the given dimension that are adjacent to
 // it.
@@ -145,6 +165,35 @@ void MoabEntitySet::getAdjacentEntities(
     }
 }
 
+//---------------------------------------------------------------------------//
+// Get an iterator over the local entities of the given type in any of the
+// mesh sets with the given indices.
+EntityIterator MoabEntitySet::meshSetEntityIterator(
+    const int topological_dimension,
+    const Teuchos::Array<int> &set_indices ) const
+{
+    // Gather the entities in the sets.
+    moab::Range entities;
+    for ( auto index : set_indices )
+    {
+        DTK_CHECK_ERROR_CODE(
+            d_moab_mesh->get_moab()->get_entities_by_dimension(
+                d_set_indexer->getMeshSetFromIndex( index ),
+                topological_dimension, entities ) );
+    }
+
+    // Create an iterator over the selected entities. The selection is
+    // complete so the iterator has an empty predicate. Ownership is not
+    // filtered here as callers combine the selection with an ownership
+    // predicate when they need one.
+    Teuchos::RCP<MoabEntityIteratorRange> iterator_range =
+        Teuchos::rcp( new MoabEntityIteratorRange() );
+    iterator_range->d_moab_entities.assign( entities.begin(),
+                                            entities.end() );
+    return MoabEntityIterator( iterator_range, d_moab_mesh.ptr(),
+                               d_set_indexer.ptr(), PredicateFunction() );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -119,6 +119,32 @@ class MoabEntitySet : public EntitySet
     entityIterator( const int topological_dimension,
                     const PredicateFunction &predicate ) const override;
 
+    /*!
+     * \brief Get an iterator over the entities of the given type in any of
+     * the given blocks. The entities are gathered from the block mesh sets
+     * instead of being selected with a predicate.
+     * \param topological_dimension The topological dimension of entity to get
+     * an iterator for.
+     * \param block_ids The mesh set indices of the blocks to select.
+     * \return A iterator over the selected entities.
+     */
+    EntityIterator
+    blockEntityIterator( const int topological_dimension,
+                         const Teuchos::Array<int> &block_ids ) const override;
+
+    /*!
+     * \brief Get an iterator over the entities of the given type on any of
+     * the given boundaries. The entities are gathered from the boundary mesh
+     * sets instead of being selected with a predicate.
+     * \param topological_dimension The topological dimension of entity to get
+     * an iterator for.
+     * \param boundary_ids The mesh set indices of the boundaries to select.
+     * \return A iterator over the selected entities.
+     */
+    EntityIterator boundaryEntityIterator(
+        const int topological_dimension,
+        const Teuchos::Array<int> &boundary_ids ) const override;
+
     /*!
      * \brief Given an entity, get the entities of the given type that are
      * adjacent to it.
@@ -133,6 +159,13 @@ class MoabEntitySet : public EntitySet
     std::string description() const { return std::string( "Moab Mesh" ); }
     //@}
 
+  private:
+    // Get an iterator over the local entities of the given type in any of
+    // the mesh sets with the given indices.
+    EntityIterator
+    meshSetEntityIterator( const int topological_dimension,
+                           const Teuchos::Array<int> &set_indices ) const;
+
   private:
     // Moab mesh.
     Teuchos::RCP<moab::ParallelComm> d_moab_mesh;
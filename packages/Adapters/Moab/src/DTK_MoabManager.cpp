@@ -41,7 +41,6 @@
 #include "DTK_MoabManager.hpp"
 #include "DTK_MoabEntityIntegrationRule.hpp"
 #include "DTK_MoabEntityLocalMap.hpp"
-#include "DTK_MoabEntityPredicates.hpp"
 #include "DTK_MoabEntitySet.hpp"
 #include "DTK_MoabMeshSetIndexer.hpp"
 #include "DTK_MoabNodalShapeFunction.hpp"
@@ -92,8 +91,6 @@ MoabManager::MoabManager( const Teuchos::RCP<moab::ParallelComm> &moab_mesh,
     Teuchos::RCP<EntitySet> entity_set =
         Teuchos::rcp( new MoabEntitySet( d_moab_mesh, d_set_indexer ) );
 
-    MoabMeshSetPredicate pred( mesh_set, d_set_indexer );
-
     Teuchos::RCP<EntityLocalMap> local_map =
         Teuchos::rcp( new MoabEntityLocalMap( d_moab_mesh ) );
 
@@ -103,9 +100,13 @@ MoabManager::MoabManager( const Teuchos::RCP<moab::ParallelComm> &moab_mesh,
     Teuchos::RCP<EntityIntegrationRule> integration_rule =
         Teuchos::rcp( new MoabEntityIntegrationRule( d_moab_mesh ) );
 
-    d_function_space = Teuchos::rcp(
-        new FunctionSpace( entity_set, local_map, shape_function,
-                           integration_rule, pred.getFunction() ) );
+    // The selection is the entities in the mesh set which the entity set
+    // gathers natively as a block.
+    Teuchos::Array<int> block_ids(
+        1, d_set_indexer->getIndexFromMeshSet( mesh_set ) );
+    d_function_space = Teuchos::rcp( new FunctionSpace(
+        entity_set, local_map, shape_function, integration_rule,
+        FunctionSpace::BLOCK_SELECTION, block_ids ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -41,6 +41,8 @@
 #ifndef DTK_MOABTAGFIELD_HPP
 #define DTK_MOABTAGFIELD_HPP
 
+#include <vector>
+
 #include "DTK_Field.hpp"
 #include "DTK_MoabMeshSetIndexer.hpp"
 #include "DTK_Types.hpp"
@@ -98,11 +100,35 @@ class MoabTagField : public Field
     void writeFieldData( const SupportId support_id, const int dimension,
                          const double data ) override;
 
+    /*!
+     * \brief Given a set of local support ids and a dimension, read data from
+     * the application field.
+     */
+    void
+    readFieldDataBulk( const Teuchos::ArrayView<const SupportId> &support_ids,
+                       const int dimension,
+                       const Teuchos::ArrayView<double> &data ) const override;
+
+    /*!
+     * \brief Given a set of local support ids, dimension, and field values,
+     * write data into the application field.
+     */
+    void writeFieldDataBulk(
+        const Teuchos::ArrayView<const SupportId> &support_ids,
+        const int dimension,
+        const Teuchos::ArrayView<const double> &data ) override;
+
     /*!
      * \brief Finalize a field after writing into it.
      */
     void finalizeAfterWrite() override;
 
+  private:
+    // Get the tag data pointers of the entities of the given support ids.
+    void
+    getTagPointers( const Teuchos::ArrayView<const SupportId> &support_ids,
+                    std::vector<const void *> &tag_data ) const;
+
   private:
     // The mesh over which the tag is defined.
     Teuchos::RCP<moab::ParallelComm> d_moab_mesh;
@@ -124,6 +150,9 @@ class MoabTagField : public Field
 
     // The support ids of the entities over which the field is constructed.
     Teuchos::Array<SupportId> d_support_ids;
+
+    // The locally-owned entities in the order of the support ids.
+    std::vector<moab::EntityHandle> d_support_entities;
 };
 
 //---------------------------------------------------------------------------//
@@ -99,6 +99,7 @@ MoabTagField<Scalar>::MoabTagField(
             if ( rank == owner_rank )
             {
                 d_support_ids.push_back( global_ids[n] );
+                d_support_entities.push_back( entities[n] );
             }
         }
     }
@@ -153,6 +154,75 @@ void MoabTagField<Scalar>::writeFieldData( const SupportId support_id,
         data;
 }
 
+//---------------------------------------------------------------------------//
+// Given a set of local support ids and a dimension, read data from the
+// application field.
+template <class Scalar>
+void MoabTagField<Scalar>::readFieldDataBulk(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int dimension, const Teuchos::ArrayView<double> &data ) const
+{
+    DTK_REQUIRE( support_ids.size() == data.size() );
+    std::vector<const void *> tag_data;
+    getTagPointers( support_ids, tag_data );
+    int num_ids = support_ids.size();
+    for ( int n = 0; n < num_ids; ++n )
+    {
+        data[n] = static_cast<const Scalar *>( tag_data[n] )[dimension];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Given a set of local support ids, dimension, and field values, write data
+// into the application field.
+template <class Scalar>
+void MoabTagField<Scalar>::writeFieldDataBulk(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int dimension, const Teuchos::ArrayView<const double> &data )
+{
+    DTK_REQUIRE( support_ids.size() == data.size() );
+    std::vector<const void *> tag_data;
+    getTagPointers( support_ids, tag_data );
+    int num_ids = support_ids.size();
+    for ( int n = 0; n < num_ids; ++n )
+    {
+        const_cast<Scalar *>( static_cast<const Scalar *>( tag_data[n] ) )
+            [dimension] = data[n];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Get the tag data pointers of the entities of the given support ids with a
+// single tag query. The entities of the field's own support ids are stored in
+// order so no lookup is needed.
+template <class Scalar>
+void MoabTagField<Scalar>::getTagPointers(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    std::vector<const void *> &tag_data ) const
+{
+    int num_ids = support_ids.size();
+    tag_data.resize( num_ids );
+    if ( 0 == num_ids )
+    {
+        return;
+    }
+
+    std::vector<moab::EntityHandle> entities;
+    const moab::EntityHandle *entity_data = d_support_entities.data();
+    if ( support_ids.getRawPtr() != d_support_ids.getRawPtr() )
+    {
+        entities.resize( num_ids );
+        for ( int n = 0; n < num_ids; ++n )
+        {
+            entities[n] = d_set_indexer->getEntityFromGlobalId(
+                support_ids[n], d_entity_dim );
+        }
+        entity_data = entities.data();
+    }
+    DTK_CHECK_ERROR_CODE( d_moab_mesh->get_moab()->tag_get_by_ptr(
+        d_tag, entity_data, num_ids, tag_data.data() ) );
+}
+
 //---------------------------------------------------------------------------//
 // Finalize a field after writing into it.
 template <class Scalar>
@@ -81,6 +81,23 @@ Teuchos::RCP<const Teuchos::Comm<Ordinal>> getDefaultComm()
 #endif
 }
 
+//---------------------------------------------------------------------------//
+// Check that two iterators visit the same entities.
+void checkSameEntities( DataTransferKit::EntityIterator a,
+                        DataTransferKit::EntityIterator b,
+                        Teuchos::FancyOStream &out, bool &success )
+{
+    std::vector<DataTransferKit::EntityId> a_ids;
+    for ( auto it = a.begin(); it != a.end(); ++it )
+        a_ids.push_back( it->id() );
+    std::sort( a_ids.begin(), a_ids.end() );
+    std::vector<DataTransferKit::EntityId> b_ids;
+    for ( auto it = b.begin(); it != b.end(); ++it )
+        b_ids.push_back( it->id() );
+    std::sort( b_ids.begin(), b_ids.end() );
+    TEST_COMPARE_ARRAYS( a_ids, b_ids );
+}
+
 //---------------------------------------------------------------------------//
 // Hex-8 test.
 TEUCHOS_UNIT_TEST( MoabEntitySet, hex_8_test )
@@ -277,6 +294,33 @@ TEUCHOS_UNIT_TEST( MoabEntitySet, hex_8_test )
         TEST_EQUALITY( 1, node_adjacent_volumes.size() );
         TEST_EQUALITY( node_adjacent_volumes[0].id(), hex_id );
     }
+
+    // The mesh set block and boundary selections must match the
+    // predicate-based selections of the base entity set.
+    Teuchos::Array<int> set_ids( 1 );
+    for ( int d = 0; d <= space_dim; d += space_dim )
+    {
+        for ( int s = 0; s < 2; ++s )
+        {
+            set_ids[0] = set_indexer->getIndexFromMeshSet(
+                ( 0 == s ) ? entity_set_1 : entity_set_2 );
+            checkSameEntities(
+                entity_set->blockEntityIterator( d, set_ids ),
+                entity_set->EntitySet::blockEntityIterator( d, set_ids ),
+                out, success );
+            checkSameEntities(
+                entity_set->boundaryEntityIterator( d, set_ids ),
+                entity_set->EntitySet::boundaryEntityIterator( d, set_ids ),
+                out, success );
+        }
+    }
+    set_ids[0] = set_indexer->getIndexFromMeshSet( entity_set_1 );
+    DataTransferKit::EntityIterator set_iterator =
+        entity_set->blockEntityIterator( space_dim, set_ids );
+    TEST_EQUALITY( set_iterator.size(), 1 );
+    set_ids[0] = set_indexer->getIndexFromMeshSet( entity_set_2 );
+    set_iterator = entity_set->blockEntityIterator( space_dim, set_ids );
+    TEST_EQUALITY( set_iterator.size(), 0 );
 }
 
 //---------------------------------------------------------------------------//
@@ -162,6 +162,13 @@ std::unique_ptr<EntityIterator> STKMeshEntityIterator::clone() const
         new STKMeshEntityIterator( *this ) );
 }
 
+//---------------------------------------------------------------------------//
+// Determine if the iterator is at the end of the entities.
+bool STKMeshEntityIterator::atEnd() const
+{
+    return ( d_stk_entity_it == d_entity_range->d_stk_entities.end() );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -113,6 +113,9 @@ class STKMeshEntityIterator : public EntityIterator
     // and assignment operator to pass along the underlying implementation.
     std::unique_ptr<EntityIterator> clone() const override;
 
+    // Determine if the iterator is at the end of the entities.
+    bool atEnd() const override;
+
   private:
     // Range of entities over which the iterator is defined.
     Teuchos::RCP<STKMeshEntityIteratorRange> d_entity_range;
@@ -38,6 +38,9 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+#include <utility>
+
 #include "DTK_STKMeshEntityLocalMap.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_IntrepidCellLocalMap.hpp"
@@ -53,6 +56,61 @@
 
 namespace DataTransferKit
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// Per-thread scratch containers reused across local map calls.
+struct STKMeshLocalMapWorkspace
+{
+    // Entity node coordinates (C,N,D).
+    Intrepid::FieldContainer<double> coords;
+
+    // Batched physical points (C,D).
+    Intrepid::FieldContainer<double> points;
+
+    // Batched reference points (C,D).
+    Intrepid::FieldContainer<double> reference_points;
+
+    // Batched entities.
+    Teuchos::Array<stk::mesh::Entity> entities;
+};
+
+//---------------------------------------------------------------------------//
+// Get the workspace of the calling thread.
+STKMeshLocalMapWorkspace &threadWorkspace()
+{
+    static thread_local STKMeshLocalMapWorkspace workspace;
+    return workspace;
+}
+
+//---------------------------------------------------------------------------//
+// Gather the node coordinates of a single entity into the workspace.
+Intrepid::FieldContainer<double> &
+entityNodeCoordinates( const stk::mesh::Entity &stk_entity,
+                       const stk::mesh::BulkData &bulk_data )
+{
+    STKMeshLocalMapWorkspace &workspace = threadWorkspace();
+    STKMeshHelpers::getEntityNodeCoordinates(
+        Teuchos::arrayView( &stk_entity, 1 ), bulk_data, workspace.coords );
+    return workspace.coords;
+}
+
+//---------------------------------------------------------------------------//
+// Resize a (C,D) container if its shape changes.
+void resizePoints( Intrepid::FieldContainer<double> &points,
+                   const int num_points, const int space_dim )
+{
+    if ( points.rank() != 2 || points.dimension( 0 ) != num_points ||
+         points.dimension( 1 ) != space_dim )
+    {
+        points.resize( num_points, space_dim );
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // end anonymous namespace
+
 //---------------------------------------------------------------------------//
 // Constructor.
 STKMeshEntityLocalMap::STKMeshEntityLocalMap(
@@ -86,9 +144,8 @@ double STKMeshEntityLocalMap::measure( const Entity &entity ) const
         STKMeshHelpers::getShardsTopology( stk_entity, *d_bulk_data );
 
     // Get the STK entity coordinates.
-    Intrepid::FieldContainer<double> entity_coords =
-        STKMeshHelpers::getEntityNodeCoordinates(
-            Teuchos::Array<stk::mesh::Entity>( 1, stk_entity ), *d_bulk_data );
+    Intrepid::FieldContainer<double> &entity_coords =
+        entityNodeCoordinates( stk_entity, *d_bulk_data );
 
     // Compute the measure of the element.
     if ( rank == stk::topology::ELEM_RANK )
@@ -129,10 +186,8 @@ void STKMeshEntityLocalMap::centroid(
     {
         shards::CellTopology entity_topo =
             STKMeshHelpers::getShardsTopology( stk_entity, *d_bulk_data );
-        Intrepid::FieldContainer<double> entity_coords =
-            STKMeshHelpers::getEntityNodeCoordinates(
-                Teuchos::Array<stk::mesh::Entity>( 1, stk_entity ),
-                *d_bulk_data );
+        Intrepid::FieldContainer<double> &entity_coords =
+            entityNodeCoordinates( stk_entity, *d_bulk_data );
         IntrepidCellLocalMap::centroid( entity_topo, entity_coords, centroid );
     }
 
@@ -146,10 +201,8 @@ void STKMeshEntityLocalMap::centroid(
     // The centroid of a node is the node coordinates.
     else if ( rank == stk::topology::NODE_RANK )
     {
-        Intrepid::FieldContainer<double> entity_coords =
-            STKMeshHelpers::getEntityNodeCoordinates(
-                Teuchos::Array<stk::mesh::Entity>( 1, stk_entity ),
-                *d_bulk_data );
+        Intrepid::FieldContainer<double> &entity_coords =
+            entityNodeCoordinates( stk_entity, *d_bulk_data );
         centroid.assign( entity_coords.getData()() );
     }
 
@@ -167,17 +220,27 @@ void STKMeshEntityLocalMap::centroid(
 bool STKMeshEntityLocalMap::isSafeToMapToReferenceFrame(
     const Entity &entity,
     const Teuchos::ArrayView<const double> &physical_point ) const
+{
+    Teuchos::Tuple<double, 6> entity_box;
+    entity.boundingBox( entity_box );
+    return isSafeToMapToReferenceFrame( entity, entity_box, physical_point );
+}
+
+//---------------------------------------------------------------------------//
+// Perform a safeguard check with a precomputed entity bounding box.
+bool STKMeshEntityLocalMap::isSafeToMapToReferenceFrame(
+    const Entity &entity, const Teuchos::Tuple<double, 6> &entity_box,
+    const Teuchos::ArrayView<const double> &physical_point ) const
 {
     // Get the STK entity.
     const stk::mesh::Entity &stk_entity =
         STKMeshHelpers::extractEntity( entity );
     stk::mesh::EntityRank rank = d_bulk_data->entity_rank( stk_entity );
 
-    // If we have an element, use the default implementation.
+    // If we have an element, use the default bounding box check.
     if ( rank == stk::topology::ELEM_RANK )
     {
-        return EntityLocalMap::isSafeToMapToReferenceFrame( entity,
-                                                            physical_point );
+        return pointInBoundingBox( entity, entity_box, physical_point );
     }
 
     // If we have a face, perform the projection safeguard.
@@ -219,10 +282,8 @@ bool STKMeshEntityLocalMap::mapToReferenceFrame(
     {
         shards::CellTopology entity_topo =
             STKMeshHelpers::getShardsTopology( stk_entity, *d_bulk_data );
-        Intrepid::FieldContainer<double> entity_coords =
-            STKMeshHelpers::getEntityNodeCoordinates(
-                Teuchos::Array<stk::mesh::Entity>( 1, stk_entity ),
-                *d_bulk_data );
+        Intrepid::FieldContainer<double> &entity_coords =
+            entityNodeCoordinates( stk_entity, *d_bulk_data );
         IntrepidCellLocalMap::mapToReferenceFrame(
             entity_topo, entity_coords, physical_point, reference_point );
     }
@@ -247,6 +308,87 @@ bool STKMeshEntityLocalMap::mapToReferenceFrame(
     return true;
 }
 
+//---------------------------------------------------------------------------//
+// Map a set of points to the reference spaces of a set of elements. Point n is
+// mapped into entity n.
+void STKMeshEntityLocalMap::mapToReferenceFrame(
+    const Teuchos::ArrayView<const Entity> &entities,
+    const Teuchos::ArrayView<const double> &physical_points,
+    const Teuchos::ArrayView<double> &reference_points ) const
+{
+    int space_dim = d_bulk_data->mesh_meta_data().spatial_dimension();
+    int num_points = entities.size();
+    DTK_REQUIRE( physical_points.size() == num_points * space_dim );
+    DTK_REQUIRE( reference_points.size() == num_points * space_dim );
+
+    // Order the pairs by topology so that each topology is inverted with a
+    // single multi-cell map.
+    Teuchos::Array<std::pair<unsigned, int>> topo_order( num_points );
+    for ( int n = 0; n < num_points; ++n )
+    {
+        const stk::mesh::Entity &stk_entity =
+            STKMeshHelpers::extractEntity( entities[n] );
+        DTK_INSIST( stk::topology::ELEM_RANK ==
+                    d_bulk_data->entity_rank( stk_entity ) );
+        topo_order[n] = std::make_pair(
+            STKMeshHelpers::getShardsTopology( stk_entity, *d_bulk_data )
+                .getKey(),
+            n );
+    }
+    std::sort( topo_order.begin(), topo_order.end() );
+
+    // Invert each topology group.
+    STKMeshLocalMapWorkspace &workspace = threadWorkspace();
+    auto group_begin = topo_order.begin();
+    while ( group_begin != topo_order.end() )
+    {
+        unsigned topo_key = group_begin->first;
+        auto group_end = std::find_if(
+            group_begin, topo_order.end(),
+            [=]( const std::pair<unsigned, int> &p ) {
+                return p.first != topo_key;
+            } );
+        int num_cells = std::distance( group_begin, group_end );
+
+        // Gather the entities and points of the group.
+        workspace.entities.resize( num_cells );
+        resizePoints( workspace.points, num_cells, space_dim );
+        resizePoints( workspace.reference_points, num_cells, space_dim );
+        for ( int c = 0; c < num_cells; ++c )
+        {
+            int n = group_begin[c].second;
+            workspace.entities[c] =
+                STKMeshHelpers::extractEntity( entities[n] );
+            for ( int d = 0; d < space_dim; ++d )
+            {
+                workspace.points( c, d ) = physical_points[n * space_dim + d];
+            }
+        }
+        STKMeshHelpers::getEntityNodeCoordinates(
+            workspace.entities(), *d_bulk_data, workspace.coords );
+
+        // Map the group.
+        shards::CellTopology entity_topo = STKMeshHelpers::getShardsTopology(
+            workspace.entities[0], *d_bulk_data );
+        IntrepidCellLocalMap::mapToReferenceFrame(
+            entity_topo, workspace.coords, workspace.points,
+            workspace.reference_points );
+
+        // Scatter the reference points.
+        for ( int c = 0; c < num_cells; ++c )
+        {
+            int n = group_begin[c].second;
+            for ( int d = 0; d < space_dim; ++d )
+            {
+                reference_points[n * space_dim + d] =
+                    workspace.reference_points( c, d );
+            }
+        }
+
+        group_begin = group_end;
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Determine if a reference point is in the parameterized space of an entity.
 bool STKMeshEntityLocalMap::checkPointInclusion(
@@ -303,10 +445,8 @@ void STKMeshEntityLocalMap::mapToPhysicalFrame(
     {
         shards::CellTopology entity_topo =
             STKMeshHelpers::getShardsTopology( stk_entity, *d_bulk_data );
-        Intrepid::FieldContainer<double> entity_coords =
-            STKMeshHelpers::getEntityNodeCoordinates(
-                Teuchos::Array<stk::mesh::Entity>( 1, stk_entity ),
-                *d_bulk_data );
+        Intrepid::FieldContainer<double> &entity_coords =
+            entityNodeCoordinates( stk_entity, *d_bulk_data );
         IntrepidCellLocalMap::mapToPhysicalFrame(
             entity_topo, entity_coords, reference_point, physical_point );
     }
@@ -106,6 +106,19 @@ class STKMeshEntityLocalMap : public EntityLocalMap
         const Entity &entity,
         const Teuchos::ArrayView<const double> &physical_point ) const override;
 
+    /*!
+     * \brief (Safeguard the reverse map) Perform the safeguard check with a
+     * precomputed bounding box of the entity.
+     * \param entity Perfrom the mapping for this entity.
+     * \param entity_box The bounding box of the entity.
+     * \param physical_point A view into an array of size physicalDimension()
+     * containing the coordinates of the point to map.
+     * \return Return true if it is safe to map to the reference frame.
+     */
+    bool isSafeToMapToReferenceFrame(
+        const Entity &entity, const Teuchos::Tuple<double, 6> &entity_box,
+        const Teuchos::ArrayView<const double> &physical_point ) const override;
+
     /*!
      * \brief (Reverse Map) Map a point to the reference space of an
      * entity. Return the parameterized point.
@@ -122,6 +135,21 @@ class STKMeshEntityLocalMap : public EntityLocalMap
         const Teuchos::ArrayView<const double> &physical_point,
         const Teuchos::ArrayView<double> &reference_point ) const override;
 
+    /*!
+     * \brief (Batched Reverse Map) Map a set of points to the reference
+     * spaces of a set of elements. Point n is mapped into entity n and the
+     * pairs are inverted together for each element topology.
+     * \param entities The elements to perform the mappings for.
+     * \param physical_points The interleaved physical coordinates of the
+     * points to map. Of size entities.size() * physicalDimension().
+     * \param reference_points The interleaved reference coordinates of the
+     * mapped points. Of size entities.size() * physicalDimension().
+     */
+    void mapToReferenceFrame(
+        const Teuchos::ArrayView<const Entity> &entities,
+        const Teuchos::ArrayView<const double> &physical_points,
+        const Teuchos::ArrayView<double> &reference_points ) const;
+
     /*!
      * \brief Determine if a reference point is in the parameterized space of
      * an entity.
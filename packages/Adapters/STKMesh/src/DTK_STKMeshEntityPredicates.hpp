@@ -69,6 +69,9 @@ class STKPartPredicate
 
     PredicateFunction getFunction() const { return PredicateFunction( *this ); }
 
+    // Get the ids of the parts an entity must be in.
+    const Teuchos::Array<int> &partIds() const { return b_part_ids; }
+
   protected:
     // Part ids.
     Teuchos::Array<int> b_part_ids;
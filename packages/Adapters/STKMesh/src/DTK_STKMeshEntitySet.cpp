@@ -38,6 +38,7 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
 #include <vector>
 
 #include "DTK_DBC.hpp"
@@ -49,9 +50,11 @@
 
 #include <stk_mesh/base/GetEntities.hpp>
 #include <stk_mesh/base/MetaData.hpp>
+#include <stk_mesh/base/Selector.hpp>
 #include <stk_topology/topology.hpp>
 
 #include <Teuchos_DefaultMpiComm.hpp>
+#include <Teuchos_as.hpp>
 
 namespace DataTransferKit
 {
@@ -109,6 +112,26 @@ STKMeshEntitySet::entityIterator( const int topological_dimension,
                                   predicate );
 }
 
+//---------------------------------------------------------------------------//
+// Get an iterator over the entities of the given type in any of the given
+// blocks.
+EntityIterator STKMeshEntitySet::blockEntityIterator(
+    const int topological_dimension,
+    const Teuchos::Array<int> &block_ids ) const
+{
+    return partEntityIterator( topological_dimension, block_ids );
+}
+
+//---------------------------------------------------------------------------//
+// Get an iterator over the entities of the given type on any of the given
+// boundaries.
+EntityIterator STKMeshEntitySet::boundaryEntityIterator(
+    const int topological_dimension,
+    const Teuchos::Array<int> &boundary_ids ) const
+{
+    return partEntityIterator( topological_dimension, boundary_ids );
+}
+
 //---------------------------------------------------------------------------//
 // Given an entity, get the entities of the given type that are adjacent to
 // it.
@@ -135,6 +158,45 @@ void STKMeshEntitySet::getAdjacentEntities(
     }
 }
 
+//---------------------------------------------------------------------------//
+// Get an iterator over the entities of the given type in any of the parts
+// with the given ordinals.
+EntityIterator STKMeshEntitySet::partEntityIterator(
+    const int topological_dimension,
+    const Teuchos::Array<int> &part_ordinals ) const
+{
+    stk::mesh::EntityRank rank =
+        STKMeshHelpers::getRankFromTopologicalDimension( topological_dimension,
+                                                         physicalDimension() );
+
+    // Get the parts.
+    const stk::mesh::PartVector &all_parts =
+        d_bulk_data->mesh_meta_data().get_parts();
+    stk::mesh::PartVector parts;
+    for ( auto part : all_parts )
+    {
+        if ( std::find( part_ordinals.begin(), part_ordinals.end(),
+                        Teuchos::as<int>( part->mesh_meta_data_ordinal() ) ) !=
+             part_ordinals.end() )
+        {
+            parts.push_back( part );
+        }
+    }
+
+    // Select the entities in the parts. The selection is complete so the
+    // iterator has an empty predicate.
+    Teuchos::RCP<STKMeshEntityIteratorRange> iterator_range =
+        Teuchos::rcp( new STKMeshEntityIteratorRange() );
+    if ( !parts.empty() )
+    {
+        stk::mesh::get_selected_entities( stk::mesh::selectUnion( parts ),
+                                          d_bulk_data->buckets( rank ),
+                                          iterator_range->d_stk_entities );
+    }
+    return STKMeshEntityIterator( iterator_range, d_bulk_data.ptr(),
+                                  PredicateFunction() );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
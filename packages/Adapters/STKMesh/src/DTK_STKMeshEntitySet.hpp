@@ -116,6 +116,32 @@ class STKMeshEntitySet : public EntitySet
     entityIterator( const int topological_dimension,
                     const PredicateFunction &predicate ) const override;
 
+    /*!
+     * \brief Get an iterator over the entities of the given type in any of
+     * the parts with the given ordinals. The entities are selected with an
+     * STK selector instead of a predicate.
+     * \param topological_dimension The topological dimension of entity to get
+     * an iterator for.
+     * \param block_ids The part ordinals of the blocks to select.
+     * \return A iterator over the selected entities.
+     */
+    EntityIterator
+    blockEntityIterator( const int topological_dimension,
+                         const Teuchos::Array<int> &block_ids ) const override;
+
+    /*!
+     * \brief Get an iterator over the entities of the given type in any of
+     * the parts with the given ordinals. The entities are selected with an
+     * STK selector instead of a predicate.
+     * \param topological_dimension The topological dimension of entity to get
+     * an iterator for.
+     * \param boundary_ids The part ordinals of the boundaries to select.
+     * \return A iterator over the selected entities.
+     */
+    EntityIterator boundaryEntityIterator(
+        const int topological_dimension,
+        const Teuchos::Array<int> &boundary_ids ) const override;
+
     /*!
      * \brief Given an entity, get the entities of the given topological
      * dimension that are adjacent to it.
@@ -125,6 +151,13 @@ class STKMeshEntitySet : public EntitySet
         Teuchos::Array<Entity> &adjacent_entities ) const override;
     //@}
 
+  private:
+    // Get an iterator over the entities of the given type in any of the
+    // parts with the given ordinals.
+    EntityIterator
+    partEntityIterator( const int topological_dimension,
+                        const Teuchos::Array<int> &part_ordinals ) const;
+
   private:
     // Mesh bulk data.
     Teuchos::RCP<stk::mesh::BulkData> d_bulk_data;
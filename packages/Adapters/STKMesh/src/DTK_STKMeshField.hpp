@@ -98,11 +98,46 @@ class STKMeshField : public Field
     void writeFieldData( const SupportId support_id, const int dimension,
                          const double data ) override;
 
+    /*!
+     * \brief Given a set of local support ids and a dimension, read data from
+     * the application field.
+     */
+    void
+    readFieldDataBulk( const Teuchos::ArrayView<const SupportId> &support_ids,
+                       const int dimension,
+                       const Teuchos::ArrayView<double> &data ) const override;
+
+    /*!
+     * \brief Given a set of local support ids, dimension, and field values,
+     * write data into the application field.
+     */
+    void writeFieldDataBulk(
+        const Teuchos::ArrayView<const SupportId> &support_ids,
+        const int dimension,
+        const Teuchos::ArrayView<const double> &data ) override;
+
+    /*!
+     * \brief Determine if the bulk read and write functions may be called
+     * concurrently.
+     */
+    bool isThreadSafe() const override { return true; }
+
     /*!
      * \brief Finalize a field after writing into it.
      */
     void finalizeAfterWrite() override;
 
+  private:
+    // Get the offset of a list of support ids in the field's own support id
+    // list. Return -1 if the list is not a view of the field's own list.
+    int supportIdOffset(
+        const Teuchos::ArrayView<const SupportId> &support_ids ) const;
+
+    // Get the entity of a support id in the given list.
+    stk::mesh::Entity
+    supportEntity( const Teuchos::ArrayView<const SupportId> &support_ids,
+                   const int id_offset, const int n ) const;
+
   private:
     // The mesh over which the field is defined.
     Teuchos::RCP<stk::mesh::BulkData> d_bulk_data;
@@ -119,6 +154,9 @@ class STKMeshField : public Field
     // The support ids of the entities over which the field is constructed.
     Teuchos::Array<SupportId> d_support_ids;
 
+    // The locally-owned entities in the order of the support ids.
+    std::vector<stk::mesh::Entity> d_support_entities;
+
     // Support id to local id map.
     std::unordered_map<SupportId, int> d_id_map;
 };
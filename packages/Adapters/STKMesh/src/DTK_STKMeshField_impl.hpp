@@ -41,6 +41,7 @@
 #ifndef DTK_STKMESHFIELD_IMPL_HPP
 #define DTK_STKMESHFIELD_IMPL_HPP
 
+#include <functional>
 #include <vector>
 
 #include "DTK_DBC.hpp"
@@ -99,6 +100,7 @@ STKMeshField<Scalar, FieldType>::STKMeshField(
         {
             d_support_ids.push_back(
                 d_bulk_data->identifier( d_field_entities[n] ) );
+            d_support_entities.push_back( d_field_entities[n] );
         }
     }
 }
@@ -147,6 +149,77 @@ void STKMeshField<Scalar, FieldType>::writeFieldData(
         data;
 }
 
+//---------------------------------------------------------------------------//
+// Given a set of local support ids and a dimension, read data from the
+// application field.
+template <class Scalar, class FieldType>
+void STKMeshField<Scalar, FieldType>::readFieldDataBulk(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int dimension, const Teuchos::ArrayView<double> &data ) const
+{
+    DTK_REQUIRE( support_ids.size() == data.size() );
+    int id_offset = supportIdOffset( support_ids );
+    int num_ids = support_ids.size();
+    for ( int n = 0; n < num_ids; ++n )
+    {
+        data[n] = stk::mesh::field_data(
+            *d_field, supportEntity( support_ids, id_offset, n ) )[dimension];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Given a set of local support ids, dimension, and field values, write data
+// into the application field.
+template <class Scalar, class FieldType>
+void STKMeshField<Scalar, FieldType>::writeFieldDataBulk(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int dimension, const Teuchos::ArrayView<const double> &data )
+{
+    DTK_REQUIRE( support_ids.size() == data.size() );
+    int id_offset = supportIdOffset( support_ids );
+    int num_ids = support_ids.size();
+    for ( int n = 0; n < num_ids; ++n )
+    {
+        stk::mesh::field_data(
+            *d_field, supportEntity( support_ids, id_offset, n ) )[dimension] =
+            data[n];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Get the offset of a list of support ids in the field's own support id
+// list. Return -1 if the list is not a view of the field's own list.
+template <class Scalar, class FieldType>
+int STKMeshField<Scalar, FieldType>::supportIdOffset(
+    const Teuchos::ArrayView<const SupportId> &support_ids ) const
+{
+    std::less<const SupportId *> less;
+    const SupportId *begin = d_support_ids.getRawPtr();
+    const SupportId *end = begin + d_support_ids.size();
+    const SupportId *ids = support_ids.getRawPtr();
+    if ( !less( ids, begin ) && !less( end, ids + support_ids.size() ) )
+    {
+        return ids - begin;
+    }
+    return -1;
+}
+
+//---------------------------------------------------------------------------//
+// Get the entity of a support id in the given list. The entities of the
+// field's own support id list are stored in order so no lookup is needed.
+template <class Scalar, class FieldType>
+stk::mesh::Entity STKMeshField<Scalar, FieldType>::supportEntity(
+    const Teuchos::ArrayView<const SupportId> &support_ids,
+    const int id_offset, const int n ) const
+{
+    if ( id_offset >= 0 )
+    {
+        return d_support_entities[id_offset + n];
+    }
+    DTK_REQUIRE( d_id_map.count( support_ids[n] ) );
+    return d_field_entities[d_id_map.find( support_ids[n] )->second];
+}
+
 //---------------------------------------------------------------------------//
 // Finalize a field after writing into it.
 template <class Scalar, class FieldType>
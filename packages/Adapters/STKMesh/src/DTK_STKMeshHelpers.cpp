@@ -204,23 +204,35 @@ STKMeshHelpers::getShardsTopology( const stk::mesh::Entity stk_entity,
 Intrepid::FieldContainer<double> STKMeshHelpers::getEntityNodeCoordinates(
     const Teuchos::Array<stk::mesh::Entity> &stk_entities,
     const stk::mesh::BulkData &bulk_data )
+{
+    Intrepid::FieldContainer<double> coords;
+    getEntityNodeCoordinates( stk_entities(), bulk_data, coords );
+    return coords;
+}
+
+//---------------------------------------------------------------------------//
+// Given a set of STK entities, write the coordinates of their nodes into a
+// field container ordered by canonical node order (C,N,D).
+void STKMeshHelpers::getEntityNodeCoordinates(
+    const Teuchos::ArrayView<const stk::mesh::Entity> &stk_entities,
+    const stk::mesh::BulkData &bulk_data,
+    Intrepid::FieldContainer<double> &coords )
 {
     int space_dim = bulk_data.mesh_meta_data().spatial_dimension();
     switch ( space_dim )
     {
     case 3:
-        return STKMeshHelpers::extractEntityNodeCoordinates<
-            stk::mesh::Cartesian3d>( stk_entities, bulk_data, space_dim );
+        STKMeshHelpers::extractEntityNodeCoordinates<stk::mesh::Cartesian3d>(
+            stk_entities, bulk_data, space_dim, coords );
         break;
     case 2:
-        return STKMeshHelpers::extractEntityNodeCoordinates<
-            stk::mesh::Cartesian2d>( stk_entities, bulk_data, space_dim );
+        STKMeshHelpers::extractEntityNodeCoordinates<stk::mesh::Cartesian2d>(
+            stk_entities, bulk_data, space_dim, coords );
         break;
     default:
         DTK_CHECK( 2 == space_dim || 3 == space_dim );
         break;
     }
-    return Intrepid::FieldContainer<double>();
 }
 
 //---------------------------------------------------------------------------//
@@ -106,6 +106,16 @@ class STKMeshHelpers
         const Teuchos::Array<stk::mesh::Entity> &stk_entities,
         const stk::mesh::BulkData &bulk_data );
 
+    /*!
+     * \brief Given a set of STK entities, write the coordinates of their
+     * nodes into a field container ordered by canonical node order
+     * (C,N,D). The container is only reallocated if its shape changes.
+     */
+    static void getEntityNodeCoordinates(
+        const Teuchos::ArrayView<const stk::mesh::Entity> &stk_entities,
+        const stk::mesh::BulkData &bulk_data,
+        Intrepid::FieldContainer<double> &coords );
+
   private:
     /*!
      * \brief Given a STK entity, return the coordinates of its nodes in a
@@ -113,9 +123,10 @@ class STKMeshHelpers
      * extraction layer.
      */
     template <class FieldType>
-    static Intrepid::FieldContainer<double> extractEntityNodeCoordinates(
-        const Teuchos::Array<stk::mesh::Entity> &stk_entities,
-        const stk::mesh::BulkData &bulk_data, const int space_dim );
+    static void extractEntityNodeCoordinates(
+        const Teuchos::ArrayView<const stk::mesh::Entity> &stk_entities,
+        const stk::mesh::BulkData &bulk_data, const int space_dim,
+        Intrepid::FieldContainer<double> &coords );
 };
 
 //---------------------------------------------------------------------------//
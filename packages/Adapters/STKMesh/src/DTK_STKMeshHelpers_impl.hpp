@@ -54,12 +54,13 @@
 namespace DataTransferKit
 {
 //---------------------------------------------------------------------------//
-// Extract the coordinates of multiple entities and return an array ordered as
+// Extract the coordinates of multiple entities into an array ordered as
 // (C,N,D).
 template <class FieldType>
-Intrepid::FieldContainer<double> STKMeshHelpers::extractEntityNodeCoordinates(
-    const Teuchos::Array<stk::mesh::Entity> &stk_entities,
-    const stk::mesh::BulkData &bulk_data, const int space_dim )
+void STKMeshHelpers::extractEntityNodeCoordinates(
+    const Teuchos::ArrayView<const stk::mesh::Entity> &stk_entities,
+    const stk::mesh::BulkData &bulk_data, const int space_dim,
+    Intrepid::FieldContainer<double> &coords )
 {
     // Cast the field.
     const stk::mesh::FieldBase *coord_field_base =
@@ -88,7 +89,12 @@ Intrepid::FieldContainer<double> STKMeshHelpers::extractEntityNodeCoordinates(
             num_nodes = std::distance( begin, end );
         }
     }
-    Intrepid::FieldContainer<double> coords( num_cells, num_nodes, space_dim );
+    if ( coords.rank() != 3 || coords.dimension( 0 ) != num_cells ||
+         coords.dimension( 1 ) != num_nodes ||
+         coords.dimension( 2 ) != space_dim )
+    {
+        coords.resize( num_cells, num_nodes, space_dim );
+    }
 
     // Extract the coordinates.
     double *node_coords = 0;
@@ -120,8 +126,6 @@ Intrepid::FieldContainer<double> STKMeshHelpers::extractEntityNodeCoordinates(
             }
         }
     }
-
-    return coords;
 }
 
 //---------------------------------------------------------------------------//
@@ -66,7 +66,7 @@ STKMeshManager::STKMeshManager(
     : d_bulk_data( bulk_data )
 {
     STKPartNamePredicate pred( part_names, d_bulk_data );
-    createFunctionSpace( basis_type, pred.getFunction() );
+    createFunctionSpace( basis_type, pred.getFunction(), pred.partIds() );
     DTK_ENSURE( Teuchos::nonnull( d_function_space ) );
 }
 
@@ -78,7 +78,7 @@ STKMeshManager::STKMeshManager(
     : d_bulk_data( bulk_data )
 {
     STKPartVectorPredicate pred( parts );
-    createFunctionSpace( basis_type, pred.getFunction() );
+    createFunctionSpace( basis_type, pred.getFunction(), pred.partIds() );
     DTK_ENSURE( Teuchos::nonnull( d_function_space ) );
 }
 
@@ -90,7 +90,8 @@ STKMeshManager::STKMeshManager(
     : d_bulk_data( bulk_data )
 {
     STKSelectorPredicate pred( selector );
-    createFunctionSpace( basis_type, pred.getFunction() );
+    createFunctionSpace( basis_type, pred.getFunction(),
+                         Teuchos::Array<int>() );
     DTK_ENSURE( Teuchos::nonnull( d_function_space ) );
 }
 
@@ -104,7 +105,8 @@ Teuchos::RCP<FunctionSpace> STKMeshManager::functionSpace() const
 //---------------------------------------------------------------------------//
 // Create the function space.
 void STKMeshManager::createFunctionSpace(
-    const BasisType basis_type, const PredicateFunction &select_function )
+    const BasisType basis_type, const PredicateFunction &select_function,
+    const Teuchos::Array<int> &block_ids )
 {
     Teuchos::RCP<EntitySet> entity_set =
         Teuchos::rcp( new STKMeshEntitySet( d_bulk_data ) );
@@ -130,9 +132,21 @@ void STKMeshManager::createFunctionSpace(
     Teuchos::RCP<EntityIntegrationRule> integration_rule =
         Teuchos::rcp( new STKMeshEntityIntegrationRule( d_bulk_data ) );
 
-    d_function_space =
-        Teuchos::rcp( new FunctionSpace( entity_set, local_map, shape_function,
-                                         integration_rule, select_function ) );
+    // Entities must be in every part of the selection. A single part is
+    // then a plain block selection that the entity set gathers natively.
+    if ( 1 == block_ids.size() )
+    {
+        d_function_space = Teuchos::rcp(
+            new FunctionSpace( entity_set, local_map, shape_function,
+                               integration_rule,
+                               FunctionSpace::BLOCK_SELECTION, block_ids ) );
+    }
+    else
+    {
+        d_function_space = Teuchos::rcp(
+            new FunctionSpace( entity_set, local_map, shape_function,
+                               integration_rule, select_function ) );
+    }
 
     DTK_ENSURE( Teuchos::nonnull( d_function_space ) );
 }
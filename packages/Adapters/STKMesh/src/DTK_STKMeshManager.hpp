@@ -202,9 +202,11 @@ class STKMeshManager : public ClientManager
     //@}
 
   private:
-    // Create the function space.
+    // Create the function space. If the selection is exactly the entities
+    // in the given parts they are given as block ids.
     void createFunctionSpace( const BasisType basis_type,
-                              const PredicateFunction &select_function );
+                              const PredicateFunction &select_function,
+                              const Teuchos::Array<int> &block_ids );
 
   private:
     // Bulk data.
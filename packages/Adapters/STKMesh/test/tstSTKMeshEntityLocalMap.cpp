@@ -257,6 +257,23 @@ TEUCHOS_UNIT_TEST( STKMeshEntity, hex_8_test )
         TEST_EQUALITY( node_coords[1], point_coords[1] );
         TEST_EQUALITY( node_coords[2], point_coords[2] );
     }
+
+    // Test the batched mapping to reference frame.
+    DataTransferKit::STKMeshEntityLocalMap stk_local_map( bulk_data );
+    Teuchos::Array<DataTransferKit::Entity> batch_entities( 2, dtk_entity );
+    Teuchos::Array<double> batch_points( good_point );
+    batch_points.insert( batch_points.end(), bad_point.begin(),
+                         bad_point.end() );
+    Teuchos::Array<double> batch_ref_points( 2 * space_dim );
+    stk_local_map.mapToReferenceFrame( batch_entities(), batch_points(),
+                                       batch_ref_points() );
+    for ( int d = 0; d < space_dim; ++d )
+    {
+        TEST_ASSERT( std::abs( batch_ref_points[d] - ref_good_point[d] ) <
+                     1.0e-12 );
+        TEST_ASSERT( std::abs( batch_ref_points[space_dim + d] -
+                               ref_bad_point[d] ) < 1.0e-12 );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -82,6 +82,23 @@ Teuchos::RCP<const Teuchos::Comm<Ordinal>> getDefaultComm()
 #endif
 }
 
+//---------------------------------------------------------------------------//
+// Check that two iterators visit the same entities.
+void checkSameEntities( DataTransferKit::EntityIterator a,
+                        DataTransferKit::EntityIterator b,
+                        Teuchos::FancyOStream &out, bool &success )
+{
+    std::vector<DataTransferKit::EntityId> a_ids;
+    for ( auto it = a.begin(); it != a.end(); ++it )
+        a_ids.push_back( it->id() );
+    std::sort( a_ids.begin(), a_ids.end() );
+    std::vector<DataTransferKit::EntityId> b_ids;
+    for ( auto it = b.begin(); it != b.end(); ++it )
+        b_ids.push_back( it->id() );
+    std::sort( b_ids.begin(), b_ids.end() );
+    TEST_COMPARE_ARRAYS( a_ids, b_ids );
+}
+
 //---------------------------------------------------------------------------//
 // Hex-8 test.
 TEUCHOS_UNIT_TEST( STKMeshEntitySet, hex_8_test )
@@ -283,6 +300,34 @@ TEUCHOS_UNIT_TEST( STKMeshEntitySet, hex_8_test )
         TEST_EQUALITY( 1, node_adjacent_volumes.size() );
         TEST_EQUALITY( node_adjacent_volumes[0].id(), hex_id );
     }
+
+    // The part-based block and boundary selections must match the
+    // predicate-based selections of the base entity set.
+    Teuchos::Array<int> part_ids( 1, part_1_id );
+    for ( int d = 0; d <= space_dim; d += space_dim )
+    {
+        for ( int p = 0; p < 2; ++p )
+        {
+            part_ids[0] = ( 0 == p ) ? part_1_id : part_2_id;
+            checkSameEntities(
+                entity_set->blockEntityIterator( d, part_ids ),
+                entity_set->EntitySet::blockEntityIterator( d, part_ids ),
+                out, success );
+            checkSameEntities(
+                entity_set->boundaryEntityIterator( d, part_ids ),
+                entity_set->EntitySet::boundaryEntityIterator( d, part_ids ),
+                out, success );
+        }
+    }
+    part_ids[0] = part_1_id;
+    DataTransferKit::EntityIterator part_iterator =
+        entity_set->blockEntityIterator( space_dim, part_ids );
+    TEST_EQUALITY( part_iterator.size(), 1 );
+    part_iterator = entity_set->blockEntityIterator( 0, part_ids );
+    TEST_EQUALITY( part_iterator.size(), num_nodes );
+    part_ids[0] = part_2_id;
+    part_iterator = entity_set->blockEntityIterator( space_dim, part_ids );
+    TEST_EQUALITY( part_iterator.size(), 0 );
 }
 
 //---------------------------------------------------------------------------//
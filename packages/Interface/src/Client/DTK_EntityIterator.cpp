@@ -38,6 +38,8 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+
 #include "DTK_EntityIterator.hpp"
 #include "DTK_DBC.hpp"
 
@@ -99,7 +101,7 @@ EntityIterator::~EntityIterator() { /* ... */}
 EntityIterator &EntityIterator::operator++()
 {
     DTK_REQUIRE( b_iterator_impl );
-    DTK_REQUIRE( *b_iterator_impl != b_iterator_impl->end() );
+    DTK_REQUIRE( !b_iterator_impl->atEnd() );
 
     increment();
     return *b_iterator_impl;
@@ -110,7 +112,7 @@ EntityIterator &EntityIterator::operator++()
 EntityIterator EntityIterator::operator++( int n )
 {
     DTK_REQUIRE( b_iterator_impl );
-    DTK_REQUIRE( *b_iterator_impl != b_iterator_impl->end() );
+    DTK_REQUIRE( !b_iterator_impl->atEnd() );
 
     const EntityIterator tmp( *this );
     increment();
@@ -157,11 +159,56 @@ std::size_t EntityIterator::size() const
     std::size_t size = 0;
     if ( b_iterator_impl )
     {
-        size = std::distance( this->begin(), this->end() );
+        // If the elements are contiguous apply the predicate directly.
+        Teuchos::ArrayView<Entity> entities;
+        if ( b_iterator_impl->contiguousEntities( entities ) )
+        {
+            size = b_predicate ? std::count_if( entities.begin(),
+                                                entities.end(), b_predicate )
+                               : entities.size();
+        }
+        else
+        {
+            size = std::distance( this->begin(), this->end() );
+        }
     }
     return size;
 }
 
+//---------------------------------------------------------------------------//
+// Get all elements in the iterator that meet the predicate criteria in
+// iteration order.
+void EntityIterator::getEntities( Teuchos::Array<Entity> &entities ) const
+{
+    entities.clear();
+    if ( b_iterator_impl )
+    {
+        // If the elements are contiguous apply the predicate directly.
+        Teuchos::ArrayView<Entity> all_entities;
+        if ( b_iterator_impl->contiguousEntities( all_entities ) )
+        {
+            if ( b_predicate )
+            {
+                std::copy_if( all_entities.begin(), all_entities.end(),
+                              std::back_inserter( entities ), b_predicate );
+            }
+            else
+            {
+                entities.assign( all_entities.begin(), all_entities.end() );
+            }
+        }
+        else
+        {
+            EntityIterator entity_end = this->end();
+            for ( EntityIterator entity_it = this->begin();
+                  entity_it != entity_end; ++entity_it )
+            {
+                entities.push_back( *entity_it );
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // An iterator assigned to the beginning.
 EntityIterator EntityIterator::begin() const
@@ -200,32 +247,51 @@ std::unique_ptr<EntityIterator> EntityIterator::clone() const
 void EntityIterator::advanceToFirstValidElement()
 {
     DTK_REQUIRE( b_iterator_impl );
-    if ( ( *this != end() ) && !b_predicate( **this ) )
+    if ( !b_iterator_impl->atEnd() && !selects( **this ) )
     {
         increment();
     }
 }
 
+//---------------------------------------------------------------------------//
+// Determine if an entity satisfies the predicate.
+bool EntityIterator::selects( const Entity &entity ) const
+{
+    return !b_predicate || b_predicate( entity );
+}
+
+//---------------------------------------------------------------------------//
+// Determine if the iterator is at the end of all elements under the
+// iterator.
+bool EntityIterator::atEnd() const { return ( *this == this->end() ); }
+
+//---------------------------------------------------------------------------//
+// Get a view of all elements under the iterator if they are stored
+// contiguously.
+bool EntityIterator::contiguousEntities(
+    Teuchos::ArrayView<Entity> &entities ) const
+{
+    return false;
+}
+
 //---------------------------------------------------------------------------//
 // Increment the iterator implementation forward until either a valid
 // increment is found or we have reached the end.
 void EntityIterator::increment()
 {
     DTK_REQUIRE( b_iterator_impl );
-    DTK_REQUIRE( *b_iterator_impl != b_iterator_impl->end() );
+    DTK_REQUIRE( !b_iterator_impl->atEnd() );
 
     // Apply the increment operator.
     EntityIterator &it = b_iterator_impl->operator++();
 
-    // Get the end of the range.
-    EntityIterator end = b_iterator_impl->end();
-
     // If the we are not at the end or the predicate is not satisfied by the
     // current element, increment until either of these conditions is
-    // satisfied.
-    while ( it != end && !b_predicate( *it ) )
+    // satisfied. Checking for the end through the implementation avoids
+    // constructing an end iterator for every increment.
+    while ( !b_iterator_impl->atEnd() && !selects( *it ) )
     {
-        it = b_iterator_impl->operator++();
+        b_iterator_impl->operator++();
     }
 }
 
@@ -48,6 +48,9 @@
 #include <DTK_Entity.hpp>
 #include <DTK_Types.hpp>
 
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+
 namespace DataTransferKit
 {
 //---------------------------------------------------------------------------//
@@ -58,7 +61,13 @@ namespace DataTransferKit
   This class provides a mechanism to iterate over a group of entity objects
   with a specified predicate operation for selection. Subclasses are
   responsible for setting the predicate with the iterator. If no predicate is
-  set the default predicate always return true for any entity.
+  set the default predicate always return true for any entity. An empty
+  predicate function also selects all entities without being called. This
+  lets iterators over precomputed selections skip predicate evaluation.
+
+  Subclasses that store their entities contiguously may expose them through
+  contiguousEntities(). size() and getEntities() then evaluate the predicate
+  directly over the entity array instead of stepping through the iterator.
 */
 //---------------------------------------------------------------------------//
 class EntityIterator : public std::iterator<std::forward_iterator_tag, Entity>
@@ -105,6 +114,10 @@ class EntityIterator : public std::iterator<std::forward_iterator_tag, Entity>
     // Number of elements in the iterator that meet the predicate criteria.
     std::size_t size() const;
 
+    // Get all elements in the iterator that meet the predicate criteria in
+    // iteration order.
+    void getEntities( Teuchos::Array<Entity> &entities ) const;
+
     // An iterator assigned to the first valid element in the iterator.
     virtual EntityIterator begin() const;
 
@@ -125,6 +138,17 @@ class EntityIterator : public std::iterator<std::forward_iterator_tag, Entity>
     // iterator.
     virtual std::unique_ptr<EntityIterator> clone() const;
 
+    // Determine if the iterator is at the end of all elements under the
+    // iterator. The default implementation compares against end().
+    // Subclasses may override this to avoid constructing an end iterator.
+    virtual bool atEnd() const;
+
+    // Get a view of all elements under the iterator, regardless of the
+    // predicate, if they are stored contiguously. Return false if they are
+    // not. The default implementation returns false.
+    virtual bool
+    contiguousEntities( Teuchos::ArrayView<Entity> &entities ) const;
+
   private:
     // Advance the iterator to the first valid element that satisfies the
     // predicate or the end of the iterator.
@@ -133,6 +157,9 @@ class EntityIterator : public std::iterator<std::forward_iterator_tag, Entity>
     // Increment the iterator implementation forward until either a valid
     // increment is found or we have reached the end.
     void increment();
+
+    // Determine if an entity satisfies the predicate.
+    bool selects( const Entity &entity ) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,178 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \brief DTK_EntityListIterator.cpp
+ * \author Stuart R. Slattery
+ * \brief Iterator over a precomputed list of entities.
+ */
+//---------------------------------------------------------------------------//
+
+#include "DTK_EntityListIterator.hpp"
+#include "DTK_DBC.hpp"
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+// Default constructor.
+EntityListIterator::EntityListIterator()
+    : d_entities( Teuchos::rcp( new Teuchos::Array<Entity>() ) )
+    , d_index( 0 )
+{
+    this->b_predicate = PredicateFunction();
+}
+
+//---------------------------------------------------------------------------//
+// Constructor.
+EntityListIterator::EntityListIterator(
+    const Teuchos::RCP<Teuchos::Array<Entity>> &entities )
+    : d_entities( entities )
+    , d_index( 0 )
+{
+    DTK_REQUIRE( Teuchos::nonnull( d_entities ) );
+    this->b_predicate = PredicateFunction();
+}
+
+//---------------------------------------------------------------------------//
+// Copy constructor.
+EntityListIterator::EntityListIterator( const EntityListIterator &rhs )
+    : d_entities( rhs.d_entities )
+    , d_index( rhs.d_index )
+{
+    this->b_predicate = PredicateFunction();
+}
+
+//---------------------------------------------------------------------------//
+// Assignment operator.
+EntityListIterator &EntityListIterator::
+operator=( const EntityListIterator &rhs )
+{
+    this->b_predicate = PredicateFunction();
+    if ( &rhs == this )
+    {
+        return *this;
+    }
+    d_entities = rhs.d_entities;
+    d_index = rhs.d_index;
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+// Pre-increment operator.
+EntityIterator &EntityListIterator::operator++()
+{
+    ++d_index;
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+// Dereference operator.
+Entity &EntityListIterator::operator*( void )
+{
+    return *( this->operator->() );
+}
+
+//---------------------------------------------------------------------------//
+// Dereference operator.
+Entity *EntityListIterator::operator->( void )
+{
+    DTK_REQUIRE( d_index < d_entities->size() );
+    return &( *d_entities )[d_index];
+}
+
+//---------------------------------------------------------------------------//
+// Equal comparison operator.
+bool EntityListIterator::operator==( const EntityIterator &rhs ) const
+{
+    const EntityListIterator *rhs_it =
+        static_cast<const EntityListIterator *>( &rhs );
+    const EntityListIterator *rhs_it_impl =
+        static_cast<const EntityListIterator *>(
+            rhs_it->b_iterator_impl.get() );
+    return ( rhs_it_impl->d_index == d_index );
+}
+
+//---------------------------------------------------------------------------//
+// Not equal comparison operator.
+bool EntityListIterator::operator!=( const EntityIterator &rhs ) const
+{
+    return !( this->operator==( rhs ) );
+}
+
+//---------------------------------------------------------------------------//
+// An iterator assigned to the beginning.
+EntityIterator EntityListIterator::begin() const
+{
+    return EntityListIterator( d_entities );
+}
+
+//---------------------------------------------------------------------------//
+// An iterator assigned to the end.
+EntityIterator EntityListIterator::end() const
+{
+    EntityListIterator end_it( d_entities );
+    end_it.d_index = d_entities->size();
+    return end_it;
+}
+
+//---------------------------------------------------------------------------//
+// Create a clone of the iterator. We need this for the copy constructor
+// and assignment operator to pass along the underlying implementation.
+std::unique_ptr<EntityIterator> EntityListIterator::clone() const
+{
+    return std::unique_ptr<EntityIterator>( new EntityListIterator( *this ) );
+}
+
+//---------------------------------------------------------------------------//
+// Determine if the iterator is at the end of the entities.
+bool EntityListIterator::atEnd() const
+{
+    return ( d_index >= d_entities->size() );
+}
+
+//---------------------------------------------------------------------------//
+// Get a view of all the entities under the iterator.
+bool EntityListIterator::contiguousEntities(
+    Teuchos::ArrayView<Entity> &entities ) const
+{
+    entities = ( *d_entities )();
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// end DTK_EntityListIterator.cpp
+//---------------------------------------------------------------------------//
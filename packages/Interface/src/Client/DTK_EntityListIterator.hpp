@@ -0,0 +1,128 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \brief DTK_EntityListIterator.hpp
+ * \author Stuart R. Slattery
+ * \brief Iterator over a precomputed list of entities.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_ENTITYLISTITERATOR_HPP
+#define DTK_ENTITYLISTITERATOR_HPP
+
+#include "DTK_Entity.hpp"
+#include "DTK_EntityIterator.hpp"
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+#include <Teuchos_RCP.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+  \class EntityListIterator
+  \brief Iterator over a precomputed list of entities.
+
+  The list holds the result of evaluating a selection once. The iterator has
+  an empty predicate so iterating over the list does not evaluate any
+  predicate.
+*/
+//---------------------------------------------------------------------------//
+class EntityListIterator : public EntityIterator
+{
+  public:
+    // Default constructor.
+    EntityListIterator();
+
+    // Constructor.
+    EntityListIterator( const Teuchos::RCP<Teuchos::Array<Entity>> &entities );
+
+    // Copy constructor.
+    EntityListIterator( const EntityListIterator &rhs );
+
+    /*!
+     * \brief Assignment operator.
+     */
+    EntityListIterator &operator=( const EntityListIterator &rhs );
+
+    // Pre-increment operator.
+    EntityIterator &operator++() override;
+
+    // Dereference operator.
+    Entity &operator*( void ) override;
+
+    // Dereference operator.
+    Entity *operator->( void ) override;
+
+    // Equal comparison operator.
+    bool operator==( const EntityIterator &rhs ) const override;
+
+    // Not equal comparison operator.
+    bool operator!=( const EntityIterator &rhs ) const override;
+
+    // An iterator assigned to the beginning.
+    EntityIterator begin() const override;
+
+    // An iterator assigned to the end.
+    EntityIterator end() const override;
+
+    // Create a clone of the iterator. We need this for the copy constructor
+    // and assignment operator to pass along the underlying implementation.
+    std::unique_ptr<EntityIterator> clone() const override;
+
+    // Determine if the iterator is at the end of the entities.
+    bool atEnd() const override;
+
+    // Get a view of all the entities under the iterator.
+    bool contiguousEntities(
+        Teuchos::ArrayView<Entity> &entities ) const override;
+
+  private:
+    // Entities to iterate over.
+    Teuchos::RCP<Teuchos::Array<Entity>> d_entities;
+
+    // Index of the current entity.
+    int d_index;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+#endif // end DTK_ENTITYLISTITERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_EntityListIterator.hpp
+//---------------------------------------------------------------------------//
@@ -66,6 +66,25 @@ bool EntityLocalMap::isSafeToMapToReferenceFrame(
     entity.boundingBox( entity_box );
 
     // Check if the point is in the bounding box of the entity.
+    return pointInBoundingBox( entity, entity_box, point );
+}
+
+//---------------------------------------------------------------------------//
+// Perform a safeguard check with a precomputed entity bounding box. The
+// default implementation ignores the box.
+bool EntityLocalMap::isSafeToMapToReferenceFrame(
+    const Entity &entity, const Teuchos::Tuple<double, 6> &entity_box,
+    const Teuchos::ArrayView<const double> &point ) const
+{
+    return isSafeToMapToReferenceFrame( entity, point );
+}
+
+//---------------------------------------------------------------------------//
+// Determine if a point is in the bounding box of an entity.
+bool EntityLocalMap::pointInBoundingBox(
+    const Entity &entity, const Teuchos::Tuple<double, 6> &entity_box,
+    const Teuchos::ArrayView<const double> &point )
+{
     double tolerance = 1.0e-6;
     int space_dim = entity.physicalDimension();
     bool in_x = true;
@@ -47,6 +47,7 @@
 #include <Teuchos_ArrayView.hpp>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Tuple.hpp>
 
 namespace DataTransferKit
 {
@@ -136,6 +137,28 @@ class EntityLocalMap
         const Entity &entity,
         const Teuchos::ArrayView<const double> &physical_point ) const;
 
+    /*!
+     * \brief (Safeguard the reverse map) Perform the safeguard check with a
+     * bounding box of the entity that was already computed by the caller.
+     *
+     * The search caches entity bounding boxes and uses this overload so that
+     * implementations whose safeguard starts with the bounding box test do
+     * not recompute the box for every candidate. The default implementation
+     * ignores the box and calls the two-argument overload.
+     *
+     * \param entity Perfrom the mapping for this entity.
+     *
+     * \param entity_box The bounding box of the entity.
+     *
+     * \param physical_point A view into an array of size physicalDimension()
+     * containing the coordinates of the point to map.
+     *
+     * \return Return true if it is safe to map to the reference frame.
+     */
+    virtual bool isSafeToMapToReferenceFrame(
+        const Entity &entity, const Teuchos::Tuple<double, 6> &entity_box,
+        const Teuchos::ArrayView<const double> &physical_point ) const;
+
     /*!
      * \brief (Reverse Map) Map a point to the reference space of an
      * entity. Return the parameterized point.
@@ -214,6 +237,17 @@ class EntityLocalMap
         const Entity &entity, const Entity &parent_entity,
         const Teuchos::ArrayView<const double> &reference_point,
         const Teuchos::ArrayView<double> &normal ) const;
+
+  protected:
+    /*!
+     * \brief Determine if a point is in the bounding box of an entity grown
+     * by a relative tolerance in each of the entity's physical dimensions.
+     * This is the check used by the default safeguard.
+     */
+    static bool
+    pointInBoundingBox( const Entity &entity,
+                        const Teuchos::Tuple<double, 6> &entity_box,
+                        const Teuchos::ArrayView<const double> &point );
 };
 
 //---------------------------------------------------------------------------//
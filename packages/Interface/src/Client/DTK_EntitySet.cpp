@@ -41,6 +41,7 @@
 #include "DTK_EntitySet.hpp"
 #include "DTK_BasicEntityPredicates.hpp"
 #include "DTK_DBC.hpp"
+#include "DTK_EntityListIterator.hpp"
 
 #include <Teuchos_CommHelpers.hpp>
 
@@ -107,6 +108,44 @@ void EntitySet::globalBoundingBox( Teuchos::Tuple<double, 6> &bounds ) const
     bounds[5] *= -1;
 }
 
+//---------------------------------------------------------------------------//
+// Get an iterator over a precomputed selection of entities of the given type
+// that satisfy the given predicate.
+EntityIterator
+EntitySet::selectedEntityIterator( const int topological_dimension,
+                                   const PredicateFunction &predicate ) const
+{
+    Teuchos::RCP<Teuchos::Array<Entity>> entities =
+        Teuchos::rcp( new Teuchos::Array<Entity>() );
+    this->entityIterator( topological_dimension, predicate )
+        .getEntities( *entities );
+    return EntityListIterator( entities );
+}
+
+//---------------------------------------------------------------------------//
+// Get an iterator over a precomputed selection of entities of the given type
+// in any of the given blocks.
+EntityIterator
+EntitySet::blockEntityIterator( const int topological_dimension,
+                                const Teuchos::Array<int> &block_ids ) const
+{
+    BlockPredicate block_predicate( block_ids );
+    return this->selectedEntityIterator( topological_dimension,
+                                         block_predicate.getFunction() );
+}
+
+//---------------------------------------------------------------------------//
+// Get an iterator over a precomputed selection of entities of the given type
+// on any of the given boundaries.
+EntityIterator EntitySet::boundaryEntityIterator(
+    const int topological_dimension,
+    const Teuchos::Array<int> &boundary_ids ) const
+{
+    BoundaryPredicate boundary_predicate( boundary_ids );
+    return this->selectedEntityIterator( topological_dimension,
+                                         boundary_predicate.getFunction() );
+}
+
 //---------------------------------------------------------------------------//
 // Provide a one line description of the object.
 std::string EntitySet::description() const
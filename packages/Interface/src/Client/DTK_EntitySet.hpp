@@ -145,6 +145,66 @@ class EntitySet : public Teuchos::Describable
     entityIterator( const int topological_dimension,
                     const PredicateFunction &predicate = selectAll ) const = 0;
 
+    /*!
+     * \brief Get an iterator over a precomputed selection of entities of the
+     * given type that satisfy the given predicate.
+     *
+     * The predicate is evaluated once for each entity when the iterator is
+     * created. Iterating over the result afterwards does not evaluate the
+     * predicate again. The default implementation stores the selected
+     * entities in a list.
+     *
+     * \param topological_dimension The topological dimension of entity to get
+     * an iterator for.
+     *
+     * \param predicate The selection predicate.
+     *
+     * \return A iterator over the selected entities.
+     */
+    virtual EntityIterator
+    selectedEntityIterator( const int topological_dimension,
+                            const PredicateFunction &predicate ) const;
+
+    /*!
+     * \brief Get an iterator over a precomputed selection of entities of the
+     * given type in any of the given blocks.
+     *
+     * The default implementation selects entities with a BlockPredicate.
+     * Clients may override this to select the entities natively. Overrides
+     * should not filter the selection by ownership. Callers combine it with
+     * a LocalEntityPredicate when they need only locally-owned entities.
+     *
+     * \param topological_dimension The topological dimension of entity to get
+     * an iterator for.
+     *
+     * \param block_ids The ids of the blocks to select.
+     *
+     * \return A iterator over the selected entities.
+     */
+    virtual EntityIterator
+    blockEntityIterator( const int topological_dimension,
+                         const Teuchos::Array<int> &block_ids ) const;
+
+    /*!
+     * \brief Get an iterator over a precomputed selection of entities of the
+     * given type on any of the given boundaries.
+     *
+     * The default implementation selects entities with a BoundaryPredicate.
+     * Clients may override this to select the entities natively. Overrides
+     * should not filter the selection by ownership. Callers combine it with
+     * a LocalEntityPredicate when they need only locally-owned entities.
+     *
+     * \param topological_dimension The topological dimension of entity to get
+     * an iterator for.
+     *
+     * \param boundary_ids The ids of the boundaries to select.
+     *
+     * \return A iterator over the selected entities.
+     */
+    virtual EntityIterator
+    boundaryEntityIterator( const int topological_dimension,
+                            const Teuchos::Array<int> &boundary_ids ) const;
+
     /*!
      * \brief Given an entity, get the entities of the given type that are
      * adjacent to it.
@@ -43,6 +43,7 @@
 
 #include "DTK_Types.hpp"
 
+#include <Teuchos_ArrayRCP.hpp>
 #include <Teuchos_ArrayView.hpp>
 
 namespace DataTransferKit
@@ -106,6 +107,60 @@ class Field
     virtual void writeFieldData( const SupportId support_id,
                                  const int dimension, const double data ) = 0;
 
+    /*!
+     * \brief Given a set of local support ids and a dimension, read data for
+     * all of them from the application field. The default implementation
+     * calls readFieldData() for each support id. Clients may override this
+     * to gather the data in bulk.
+     */
+    virtual void
+    readFieldDataBulk( const Teuchos::ArrayView<const SupportId> &support_ids,
+                       const int dimension,
+                       const Teuchos::ArrayView<double> &data ) const
+    {
+        for ( int n = 0; n < support_ids.size(); ++n )
+        {
+            data[n] = readFieldData( support_ids[n], dimension );
+        }
+    }
+
+    /*!
+     * \brief Given a set of local support ids, a dimension, and field values,
+     * write data for all of them into the application field. The default
+     * implementation calls writeFieldData() for each support id. Clients may
+     * override this to scatter the data in bulk.
+     */
+    virtual void
+    writeFieldDataBulk( const Teuchos::ArrayView<const SupportId> &support_ids,
+                        const int dimension,
+                        const Teuchos::ArrayView<const double> &data )
+    {
+        for ( int n = 0; n < support_ids.size(); ++n )
+        {
+            writeFieldData( support_ids[n], dimension, data[n] );
+        }
+    }
+
+    /*!
+     * \brief Determine if the bulk read and write functions may be called
+     * concurrently from multiple threads on disjoint sets of support ids.
+     * The default implementation returns false.
+     */
+    virtual bool isThreadSafe() const { return false; }
+
+    /*!
+     * \brief Get a view of the field data if it is stored contiguously in
+     * BLOCKED order. The view must hold dimension() blocks, one per field
+     * dimension, each ordered as getLocalSupportIds() and with no padding
+     * between blocks. If such a view is returned the field data may be
+     * read and written through it directly instead of through the
+     * read/write functions. The default implementation returns a null view.
+     */
+    virtual Teuchos::ArrayRCP<double> viewBlockedData()
+    {
+        return Teuchos::ArrayRCP<double>();
+    }
+
     /*!
      * \brief Finalize a field after writing into it. This lets some clients
      * do a post-process (e.g. update ghost values). Default finalize does
@@ -38,13 +38,101 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <type_traits>
+
 #include "DTK_FieldMultiVector.hpp"
 #include "DTK_DBC.hpp"
+#include "DTK_ThreadedBlocks.hpp"
+
+#include <Teuchos_Array.hpp>
 
 #include <Tpetra_Map.hpp>
 
+#include <Kokkos_View.hpp>
+
 namespace DataTransferKit
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// Vector storage for memory spaces that cannot access application data
+// directly. Field data is always copied.
+template <class DualView, bool HostAccessible>
+struct FieldStorage
+{
+    static bool wraps( const Teuchos::ArrayRCP<double> &, const int,
+                       const int )
+    {
+        return false;
+    }
+
+    static DualView create( const Teuchos::ArrayRCP<double> &,
+                            const int num_supports, const int dim )
+    {
+        return DualView( "FieldMultiVector", num_supports, dim );
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Vector storage for host-accessible memory spaces. Contiguous BLOCKED field
+// data is wrapped in an unmanaged view if it holds exactly one block per
+// field dimension. Otherwise the field data is copied.
+template <class DualView>
+struct FieldStorage<DualView, true>
+{
+    static bool wraps( const Teuchos::ArrayRCP<double> &data,
+                       const int num_supports, const int dim )
+    {
+        return !data.is_null() && ( data.size() == num_supports * dim );
+    }
+
+    static DualView create( const Teuchos::ArrayRCP<double> &data,
+                            const int num_supports, const int dim )
+    {
+        if ( !wraps( data, num_supports, dim ) )
+        {
+            return DualView( "FieldMultiVector", num_supports, dim );
+        }
+
+        Kokkos::View<double **, Kokkos::LayoutLeft,
+                     typename DualView::t_dev::device_type,
+                     Kokkos::MemoryUnmanaged>
+            unmanaged( data.getRawPtr(), num_supports, dim );
+        typename DualView::t_dev dev_view = unmanaged;
+        typename DualView::t_host host_view = dev_view;
+        return DualView( dev_view, host_view );
+    }
+};
+
+//---------------------------------------------------------------------------//
+template <class DualView>
+using FieldStorageType = FieldStorage<
+    DualView, std::is_same<typename DualView::t_dev::memory_space,
+                           Kokkos::HostSpace>::value>;
+
+//---------------------------------------------------------------------------//
+// Apply a copy kernel to contiguous blocks of the field support ids. If DTK
+// is built with OpenMP and the field is thread-safe the blocks are copied
+// concurrently.
+template <class Kernel>
+void copySupportBlocks( const Field &field, const int num_supports,
+                        const Kernel &kernel )
+{
+    // Do not thread small copies.
+    const int min_block_size = 1024;
+    int num_blocks =
+        numThreadBlocks( num_supports, min_block_size, field.isThreadSafe() );
+    forEachBlock(
+        num_supports, num_blocks,
+        [&]( const int, const int block_begin, const int block_end ) {
+            kernel( block_begin, block_end - block_begin );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end anonymous namespace
+
 //---------------------------------------------------------------------------//
 // Comm constructor.
 FieldMultiVector::FieldMultiVector(
@@ -52,8 +140,12 @@ FieldMultiVector::FieldMultiVector(
     const Teuchos::RCP<Field> &field )
     : Base( Tpetra::createNonContigMap<int, SupportId>(
                 field->getLocalSupportIds(), global_comm ),
-            field->dimension() )
+            createStorage( field ) )
     , d_field( field )
+    , d_field_data( field->viewBlockedData() )
+    , d_zero_copy( FieldStorageType<dual_view_type>::wraps(
+          d_field_data, field->getLocalSupportIds().size(),
+          field->dimension() ) )
 { /* ... */
 }
 
@@ -64,8 +156,12 @@ FieldMultiVector::FieldMultiVector(
     const Teuchos::RCP<const EntitySet> &entity_set )
     : Base( Tpetra::createNonContigMap<int, SupportId>(
                 field->getLocalSupportIds(), entity_set->communicator() ),
-            field->dimension() )
+            createStorage( field ) )
     , d_field( field )
+    , d_field_data( field->viewBlockedData() )
+    , d_zero_copy( FieldStorageType<dual_view_type>::wraps(
+          d_field_data, field->getLocalSupportIds().size(),
+          field->dimension() ) )
 { /* ... */
 }
 
@@ -73,44 +169,98 @@ FieldMultiVector::FieldMultiVector(
 // Pull data from the application and put it in the vector.
 void FieldMultiVector::pullDataFromApplication()
 {
+    if ( d_zero_copy )
+    {
+        return;
+    }
+
     Teuchos::ArrayView<const SupportId> field_supports =
         d_field->getLocalSupportIds();
 
     int num_supports = field_supports.size();
     int dim = d_field->dimension();
 
+    // Get the vector views up front. Getting them is not thread-safe. The
+    // reference counts of the views are not atomic so the threads only see
+    // raw pointers.
+    Teuchos::Array<Teuchos::ArrayRCP<double>> vector_views( dim );
+    Teuchos::Array<double *> vector_data( dim );
     for ( int d = 0; d < dim; ++d )
     {
-        Teuchos::ArrayRCP<double> vector_view = this->getDataNonConst( d );
-        for ( int n = 0; n < num_supports; ++n )
+        vector_views[d] = this->getDataNonConst( d );
+        vector_data[d] = vector_views[d].getRawPtr();
+    }
+    const SupportId *support_data = field_supports.getRawPtr();
+
+    const Field &field = *d_field;
+    copySupportBlocks( field, num_supports, [&]( const int begin,
+                                                 const int size ) {
+        Teuchos::ArrayView<const SupportId> block_supports(
+            support_data + begin, size );
+        for ( int d = 0; d < dim; ++d )
         {
-            vector_view[n] = d_field->readFieldData( field_supports[n], d );
+            field.readFieldDataBulk(
+                block_supports, d,
+                Teuchos::ArrayView<double>( vector_data[d] + begin, size ) );
         }
-    }
+    } );
 }
 
 //---------------------------------------------------------------------------//
 // Push data from the vector into the application.
 void FieldMultiVector::pushDataToApplication()
 {
+    if ( d_zero_copy )
+    {
+        d_field->finalizeAfterWrite();
+        return;
+    }
+
     Teuchos::ArrayView<const SupportId> field_supports =
         d_field->getLocalSupportIds();
 
     int num_supports = field_supports.size();
     int dim = d_field->dimension();
 
+    // Get the vector views up front. Getting them is not thread-safe. The
+    // reference counts of the views are not atomic so the threads only see
+    // raw pointers.
+    Teuchos::Array<Teuchos::ArrayRCP<const double>> vector_views( dim );
+    Teuchos::Array<const double *> vector_data( dim );
     for ( int d = 0; d < dim; ++d )
     {
-        Teuchos::ArrayRCP<double> vector_view = this->getDataNonConst( d );
-        for ( int n = 0; n < num_supports; ++n )
+        vector_views[d] = this->getData( d );
+        vector_data[d] = vector_views[d].getRawPtr();
+    }
+    const SupportId *support_data = field_supports.getRawPtr();
+
+    Field &field = *d_field;
+    copySupportBlocks( field, num_supports, [&]( const int begin,
+                                                 const int size ) {
+        Teuchos::ArrayView<const SupportId> block_supports(
+            support_data + begin, size );
+        for ( int d = 0; d < dim; ++d )
         {
-            d_field->writeFieldData( field_supports[n], d, vector_view[n] );
+            field.writeFieldDataBulk(
+                block_supports, d,
+                Teuchos::ArrayView<const double>( vector_data[d] + begin,
+                                                  size ) );
         }
-    }
+    } );
 
     d_field->finalizeAfterWrite();
 }
 
+//---------------------------------------------------------------------------//
+// Create the vector storage for a field.
+FieldMultiVector::dual_view_type
+FieldMultiVector::createStorage( const Teuchos::RCP<Field> &field )
+{
+    return FieldStorageType<dual_view_type>::create(
+        field->viewBlockedData(), field->getLocalSupportIds().size(),
+        field->dimension() );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -45,6 +45,7 @@
 #include "DTK_Field.hpp"
 #include "DTK_Types.hpp"
 
+#include <Teuchos_ArrayRCP.hpp>
 #include <Teuchos_Comm.hpp>
 #include <Teuchos_RCP.hpp>
 
@@ -62,6 +63,13 @@ namespace DataTransferKit
   access to field data on an entity-by-entity basis. The FieldMultiVector then
   manages the copying of data between the application and the Tpetra vector
   using the client implementations for data access.
+
+  If the field provides a view of its data in contiguous BLOCKED order and
+  that memory is accessible from the vector's execution space, the vector
+  wraps the application memory directly. No copies are made in that case and
+  pulling and pushing data only finalizes the field. A view that does not
+  hold exactly one block per field dimension is not wrapped and the field
+  data is copied instead.
 */
 //---------------------------------------------------------------------------//
 class FieldMultiVector : public Tpetra::MultiVector<double, int, SupportId>
@@ -71,9 +79,11 @@ class FieldMultiVector : public Tpetra::MultiVector<double, int, SupportId>
     typedef Tpetra::MultiVector<double, int, SupportId> Base;
     typedef typename Base::local_ordinal_type LO;
     typedef typename Base::global_ordinal_type GO;
+    typedef typename Base::dual_view_type dual_view_type;
 
     /*!
-     * \brief Comm constructor. This will allocate the Tpetra vector.
+     * \brief Comm constructor. This will allocate the Tpetra vector unless the
+     * field data can be wrapped directly.
      *
      * \param field The field for which we are building a vector.
      *
@@ -84,7 +94,8 @@ class FieldMultiVector : public Tpetra::MultiVector<double, int, SupportId>
                       const Teuchos::RCP<Field> &field );
 
     /*!
-     * \brief Entity set constructor. This will allocate the Tpetra vector.
+     * \brief Entity set constructor. This will allocate the Tpetra vector
+     * unless the field data can be wrapped directly.
      *
      * \param field The field for which we are building a vector.
      *
@@ -103,9 +114,24 @@ class FieldMultiVector : public Tpetra::MultiVector<double, int, SupportId>
      */
     void pushDataToApplication();
 
+    /*!
+     * \brief Determine if the vector wraps the application data directly.
+     */
+    bool isZeroCopy() const { return d_zero_copy; }
+
+  private:
+    // Create the vector storage for a field.
+    static dual_view_type createStorage( const Teuchos::RCP<Field> &field );
+
   private:
     // The field this multivector is managing.
     Teuchos::RCP<Field> d_field;
+
+    // The application data wrapped by the vector, if any.
+    Teuchos::ArrayRCP<double> d_field_data;
+
+    // True if the vector wraps the application data directly.
+    bool d_zero_copy;
 };
 
 //---------------------------------------------------------------------------//
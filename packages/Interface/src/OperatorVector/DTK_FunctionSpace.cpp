@@ -39,7 +39,10 @@
 //---------------------------------------------------------------------------//
 
 #include "DTK_FunctionSpace.hpp"
+#include "DTK_BasicEntityPredicates.hpp"
 #include "DTK_DBC.hpp"
+#include "DTK_EntityListIterator.hpp"
+#include "DTK_PredicateComposition.hpp"
 
 namespace DataTransferKit
 {
@@ -56,9 +59,42 @@ FunctionSpace::FunctionSpace(
     , d_shape_function( shape_function )
     , d_integration_rule( integration_rule )
     , d_select_function( select_function )
+    , d_selection_type( PREDICATE_SELECTION )
 { /* ... */
 }
 
+//---------------------------------------------------------------------------//
+//! Block or boundary selection constructor.
+FunctionSpace::FunctionSpace(
+    const Teuchos::RCP<EntitySet> &entity_set,
+    const Teuchos::RCP<EntityLocalMap> &local_map,
+    const Teuchos::RCP<EntityShapeFunction> &shape_function,
+    const Teuchos::RCP<EntityIntegrationRule> &integration_rule,
+    const SelectionType selection_type,
+    const Teuchos::Array<int> &selection_ids )
+    : d_entity_set( entity_set )
+    , d_local_map( local_map )
+    , d_shape_function( shape_function )
+    , d_integration_rule( integration_rule )
+    , d_selection_type( selection_type )
+    , d_selection_ids( selection_ids )
+{
+    DTK_REQUIRE( BLOCK_SELECTION == selection_type ||
+                 BOUNDARY_SELECTION == selection_type );
+
+    // Keep an equivalent select function for clients that evaluate the
+    // selection entity by entity.
+    if ( BLOCK_SELECTION == d_selection_type )
+    {
+        d_select_function = BlockPredicate( d_selection_ids ).getFunction();
+    }
+    else
+    {
+        d_select_function =
+            BoundaryPredicate( d_selection_ids ).getFunction();
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Get the entity set over which the fields are defined.
 Teuchos::RCP<EntitySet> FunctionSpace::entitySet() const
@@ -94,6 +130,53 @@ PredicateFunction FunctionSpace::selectFunction() const
     return d_select_function;
 }
 
+//---------------------------------------------------------------------------//
+// Get the selection type.
+FunctionSpace::SelectionType FunctionSpace::selectionType() const
+{
+    return d_selection_type;
+}
+
+//---------------------------------------------------------------------------//
+// Get an iterator over the selected entities of the given type that also
+// satisfy the given predicate.
+EntityIterator FunctionSpace::selectedEntityIterator(
+    const int topological_dimension, const PredicateFunction &predicate ) const
+{
+    DTK_REQUIRE( Teuchos::nonnull( d_entity_set ) );
+
+    // Compose general selections with the predicate. An empty predicate
+    // selects all entities.
+    if ( PREDICATE_SELECTION == d_selection_type )
+    {
+        return d_entity_set->selectedEntityIterator(
+            topological_dimension,
+            predicate ? PredicateComposition::And( d_select_function,
+                                                   predicate )
+                      : d_select_function );
+    }
+
+    // Let the entity set gather plain selections natively and filter them.
+    EntityIterator selection =
+        ( BLOCK_SELECTION == d_selection_type )
+            ? d_entity_set->blockEntityIterator( topological_dimension,
+                                                 d_selection_ids )
+            : d_entity_set->boundaryEntityIterator( topological_dimension,
+                                                    d_selection_ids );
+    Teuchos::RCP<Teuchos::Array<Entity>> entities =
+        Teuchos::rcp( new Teuchos::Array<Entity>() );
+    entities->reserve( selection.size() );
+    EntityIterator selection_end = selection.end();
+    for ( EntityIterator it = selection.begin(); it != selection_end; ++it )
+    {
+        if ( !predicate || predicate( *it ) )
+        {
+            entities->push_back( *it );
+        }
+    }
+    return EntityListIterator( entities );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -42,11 +42,13 @@
 #define DTK_FUNCTIONSPACE_HPP
 
 #include "DTK_EntityIntegrationRule.hpp"
+#include "DTK_EntityIterator.hpp"
 #include "DTK_EntityLocalMap.hpp"
 #include "DTK_EntitySet.hpp"
 #include "DTK_EntityShapeFunction.hpp"
 #include "DTK_Types.hpp"
 
+#include <Teuchos_Array.hpp>
 #include <Teuchos_RCP.hpp>
 
 namespace DataTransferKit
@@ -58,11 +60,24 @@ namespace DataTransferKit
 
   FunctionSpace binds the functional support of a field to a parallel vector
   space over a selected subset of the entity set.
+
+  The subset is chosen by a select function or as a plain selection of blocks
+  or boundaries. Plain selections are gathered with the blockEntityIterator()
+  or boundaryEntityIterator() of the entity set so clients can select them
+  natively.
 */
 //---------------------------------------------------------------------------//
 class FunctionSpace
 {
   public:
+    //! Selection types.
+    enum SelectionType
+    {
+        PREDICATE_SELECTION,
+        BLOCK_SELECTION,
+        BOUNDARY_SELECTION
+    };
+
     /*!
      * \brief Constructor.
      */
@@ -72,6 +87,20 @@ class FunctionSpace
                    const Teuchos::RCP<EntityIntegrationRule> &integration_rule,
                    const PredicateFunction &select_function = selectAll );
 
+    /*!
+     * \brief Block or boundary selection constructor.
+     *
+     * \param selection_type BLOCK_SELECTION or BOUNDARY_SELECTION.
+     *
+     * \param selection_ids The ids of the blocks or boundaries to select.
+     */
+    FunctionSpace( const Teuchos::RCP<EntitySet> &entity_set,
+                   const Teuchos::RCP<EntityLocalMap> &local_map,
+                   const Teuchos::RCP<EntityShapeFunction> &shape_function,
+                   const Teuchos::RCP<EntityIntegrationRule> &integration_rule,
+                   const SelectionType selection_type,
+                   const Teuchos::Array<int> &selection_ids );
+
     /*!
      * \brief Get the entity set over which the fields are defined.
      */
@@ -97,6 +126,31 @@ class FunctionSpace
      */
     PredicateFunction selectFunction() const;
 
+    /*!
+     * \brief Get the selection type.
+     */
+    SelectionType selectionType() const;
+
+    /*!
+     * \brief Get an iterator over the selected entities of the given type that
+     * also satisfy the given predicate.
+     *
+     * Block and boundary selections come from the entity set's
+     * blockEntityIterator() or boundaryEntityIterator() and are then filtered
+     * by the predicate. Other selections compose the select function with the
+     * predicate in selectedEntityIterator().
+     *
+     * \param topological_dimension The topological dimension of entity to get
+     * an iterator for.
+     *
+     * \param predicate The additional selection predicate.
+     *
+     * \return A iterator over the selected entities.
+     */
+    EntityIterator
+    selectedEntityIterator( const int topological_dimension,
+                            const PredicateFunction &predicate ) const;
+
     /*!
      * \brief Default select function.
      */
@@ -117,6 +171,12 @@ class FunctionSpace
 
     // The selector function.
     PredicateFunction d_select_function;
+
+    // The selection type.
+    SelectionType d_selection_type;
+
+    // The selected block or boundary ids.
+    Teuchos::Array<int> d_selection_ids;
 };
 
 //---------------------------------------------------------------------------//
@@ -159,6 +159,13 @@ std::unique_ptr<EntityIterator> IntegrationPointSetIterator::clone() const
         new IntegrationPointSetIterator( *this ) );
 }
 
+//---------------------------------------------------------------------------//
+// Determine if the iterator is at the end of the entities.
+bool IntegrationPointSetIterator::atEnd() const
+{
+    return ( d_points_it == d_points->end() );
+}
+
 //---------------------------------------------------------------------------//
 // IntegrationPointSet Implementation
 //---------------------------------------------------------------------------//
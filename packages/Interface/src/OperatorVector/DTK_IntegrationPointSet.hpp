@@ -102,6 +102,9 @@ class IntegrationPointSetIterator : public EntityIterator
     // and assignment operator to pass along the underlying implementation.
     std::unique_ptr<EntityIterator> clone() const override;
 
+    // Determine if the iterator is at the end of the entities.
+    bool atEnd() const override;
+
   private:
     // Map to iterate over.
     Teuchos::RCP<Teuchos::Array<IntegrationPoint>> d_points;
@@ -85,6 +85,15 @@ void MapOperator::setup( const Teuchos::RCP<FunctionSpace> &domain_space,
     d_setup_is_complete = true;
 }
 
+//---------------------------------------------------------------------------//
+// Update the map operator.
+void MapOperator::update( const Teuchos::RCP<FunctionSpace> &domain_space,
+                          const Teuchos::RCP<FunctionSpace> &range_space )
+{
+    DTK_REQUIRE( d_setup_is_complete );
+    updateImpl( domain_space, range_space );
+}
+
 //---------------------------------------------------------------------------//
 bool MapOperator::setupIsComplete() const { return d_setup_is_complete; }
 
@@ -110,6 +119,14 @@ void MapOperator::apply( const TpetraMultiVector &X, TpetraMultiVector &Y,
 // Check if the map has a transpose apply option.n
 bool MapOperator::hasTransposeApply() const { return hasTransposeApplyImpl(); }
 
+//---------------------------------------------------------------------------//
+// Default update implementation.
+void MapOperator::updateImpl( const Teuchos::RCP<FunctionSpace> &domain_space,
+                              const Teuchos::RCP<FunctionSpace> &range_space )
+{
+    setupImpl( domain_space, range_space );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -108,6 +108,22 @@ class MapOperator : public Tpetra::Operator<double, int, SupportId>
     void setup( const Teuchos::RCP<FunctionSpace> &domain_space,
                 const Teuchos::RCP<FunctionSpace> &range_space );
 
+    /*!
+     * \brief Update the map operator after the entities of the domain
+     * and/or range function spaces have moved. The operator must have been
+     * setup with the same function spaces. Subclasses may override the
+     * updateImpl() function to reuse the results of the last setup. By
+     * default a complete setup is performed.
+     *
+     * \param domain_space The function space that was used to setup the
+     * domain of the operator.
+     *
+     * \param range_space The function space that was used to setup the range
+     * of the operator.
+     */
+    void update( const Teuchos::RCP<FunctionSpace> &domain_space,
+                 const Teuchos::RCP<FunctionSpace> &range_space );
+
     /*!
      * \brief Return whether or not the operator has been setup.
      */
@@ -134,6 +150,11 @@ class MapOperator : public Tpetra::Operator<double, int, SupportId>
     setupImpl( const Teuchos::RCP<FunctionSpace> &domain_space,
                const Teuchos::RCP<FunctionSpace> &range_space ) = 0;
 
+    //! Update implementation. The default performs a complete setup.
+    virtual void
+    updateImpl( const Teuchos::RCP<FunctionSpace> &domain_space,
+                const Teuchos::RCP<FunctionSpace> &range_space );
+
     //! Apply implementation. Subclasses should override.
     virtual void applyImpl( const TpetraMultiVector &X, TpetraMultiVector &Y,
                             Teuchos::ETransp mode, double alpha,
@@ -0,0 +1,406 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   operator_benchmark.cpp
+ * \author Stuart R. Slattery
+ * \brief  Search and map operator benchmark on synthetic hex meshes.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "reference_implementation/DTK_ReferenceHexMesh.hpp"
+
+#include <DTK_BasicEntityPredicates.hpp>
+#include <DTK_FieldMultiVector.hpp>
+#include <DTK_MapOperatorFactory.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_StandardCatchMacros.hpp>
+#include <Teuchos_Time.hpp>
+#include <Teuchos_TimeMonitor.hpp>
+#include <Teuchos_as.hpp>
+
+//---------------------------------------------------------------------------//
+// Phase timers.
+//---------------------------------------------------------------------------//
+
+// The DTK timers and the phase each one is reported under.
+const std::vector<std::pair<std::string, std::string>> phase_timers = {
+    {"DTK: Coarse Global Search", "coarse_global"},
+    {"DTK: Coarse Local Search", "coarse_local"},
+    {"DTK: Fine Local Search", "fine_local"},
+    {"DTK: Search Communication", "communication"},
+    {"DTK: Center Distribution", "communication"},
+    {"DTK: Matrix Fill", "matrix_fill"}};
+
+// The reported phases in output order.
+const std::vector<std::string> phase_names = {
+    "coarse_global", "coarse_local", "fine_local", "communication",
+    "matrix_fill",   "setup",        "apply"};
+
+//---------------------------------------------------------------------------//
+// Reset the DTK phase timers.
+void resetPhaseTimers()
+{
+    for ( auto &timer : phase_timers )
+    {
+        auto counter = Teuchos::TimeMonitor::lookupCounter( timer.first );
+        if ( Teuchos::nonnull( counter ) )
+        {
+            counter->reset();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Get the local time spent in a phase by the DTK timers.
+double localPhaseTime( const std::string &phase )
+{
+    double time = 0.0;
+    for ( auto &timer : phase_timers )
+    {
+        if ( phase == timer.second )
+        {
+            auto counter = Teuchos::TimeMonitor::lookupCounter( timer.first );
+            if ( Teuchos::nonnull( counter ) )
+            {
+                time += counter->totalElapsedTime();
+            }
+        }
+    }
+    return time;
+}
+
+//---------------------------------------------------------------------------//
+// Helper functions.
+//---------------------------------------------------------------------------//
+// Split a comma separated list.
+std::vector<std::string> splitList( const std::string &list )
+{
+    std::vector<std::string> items;
+    std::stringstream stream( list );
+    std::string item;
+    while ( std::getline( stream, item, ',' ) )
+    {
+        if ( !item.empty() )
+        {
+            items.push_back( item );
+        }
+    }
+    return items;
+}
+
+//---------------------------------------------------------------------------//
+// Source field data.
+double dataFunction( const Teuchos::ArrayView<const double> &x )
+{
+    return 9.3 * x[0] + 2.2 * x[1] + 1.33 * x[2] + 1.0;
+}
+
+//---------------------------------------------------------------------------//
+// Build the parameters for an operator.
+Teuchos::RCP<Teuchos::ParameterList>
+operatorParameters( const std::string &op, const bool threaded )
+{
+    Teuchos::RCP<Teuchos::ParameterList> parameters = Teuchos::parameterList();
+
+    // Mesh-based operators.
+    if ( "consistent_interpolation" == op || "l2_projection" == op )
+    {
+        if ( "consistent_interpolation" == op )
+        {
+            parameters->set<std::string>( "Map Type",
+                                          "Consistent Interpolation" );
+            parameters->sublist( "Consistent Interpolation" );
+        }
+        else
+        {
+            parameters->set<std::string>( "Map Type", "L2 Projection" );
+            parameters->sublist( "L2 Projection" )
+                .set<int>( "Integration Order", 3 );
+        }
+        Teuchos::ParameterList &search_list = parameters->sublist( "Search" );
+        search_list.set<double>( "Point Inclusion Tolerance", 1.0e-6 );
+        search_list.set<bool>( "Threaded Local Search", threaded );
+        return parameters;
+    }
+
+    // Point cloud operators.
+    parameters->set<std::string>( "Map Type", "Point Cloud" );
+    Teuchos::ParameterList &cloud_list = parameters->sublist( "Point Cloud" );
+    cloud_list.set<int>( "Spatial Dimension", 3 );
+    cloud_list.set<bool>( "Threaded Local Search", threaded );
+    if ( "node_to_node" == op )
+    {
+        cloud_list.set<std::string>( "Map Type", "Node To Node" );
+        return parameters;
+    }
+    if ( "spline" == op )
+    {
+        cloud_list.set<std::string>( "Map Type", "Spline Interpolation" );
+    }
+    else if ( "mls" == op )
+    {
+        cloud_list.set<std::string>( "Map Type",
+                                     "Moving Least Square Reconstruction" );
+    }
+    else
+    {
+        throw std::invalid_argument( "Unknown operator: " + op );
+    }
+    cloud_list.set<std::string>( "Basis Type", "Wendland" );
+    cloud_list.set<int>( "Basis Order", 0 );
+    cloud_list.set<std::string>( "Type of Search", "Nearest Neighbor" );
+    cloud_list.set<int>( "Num Neighbors", 12 );
+    return parameters;
+}
+
+//---------------------------------------------------------------------------//
+// Write the source field data.
+void writeSourceData( const DataTransferKit::UnitTest::ReferenceHexMesh &mesh,
+                      DataTransferKit::Field &field )
+{
+    auto space = mesh.functionSpace();
+    DataTransferKit::LocalEntityPredicate local_pred(
+        space->entitySet()->communicator()->getRank() );
+    auto nodes =
+        space->entitySet()->entityIterator( 0, local_pred.getFunction() );
+    auto nodes_begin = nodes.begin();
+    auto nodes_end = nodes.end();
+    Teuchos::Array<double> coords( 3 );
+    for ( nodes = nodes_begin; nodes != nodes_end; ++nodes )
+    {
+        space->localMap()->centroid( *nodes, coords() );
+        field.writeFieldData( nodes->id(), 0, dataFunction( coords() ) );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Benchmark driver.
+//
+// To execute the benchmark run:
+//
+// mpiexec -np <ranks> ./DataTransferKitOperators_OperatorBenchmark.exe
+// --cells=16,32 --operators=all --repeat=10 --json-out-file=dtk.json
+//
+// Each entry of --cells gives the number of source mesh cells in each
+// direction. The target mesh has one more cell in each direction except for
+// the node-to-node operator, which needs coincident nodes. With --weak the
+// number of cells in z is scaled by the number of ranks. The meshes are
+// partitioned in z so there must be at least one cell in z per rank.
+//
+// Each phase time is the maximum over the ranks in seconds. The apply time is
+// the average over the repeated applies.
+//---------------------------------------------------------------------------//
+int main( int argc, char *argv[] )
+{
+    Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+
+    // Read the command line options.
+    std::string cells_list = "8,16";
+    std::string operators_list = "all";
+    std::string json_file;
+    int num_repeat = 10;
+    bool threaded = false;
+    bool weak = false;
+    Teuchos::CommandLineProcessor clp( false );
+    clp.setOption( "cells", &cells_list,
+                   "Comma separated source mesh cells in each direction" );
+    clp.setOption( "operators", &operators_list,
+                   "Comma separated operators or all. Available operators: "
+                   "consistent_interpolation, l2_projection, spline, mls, "
+                   "node_to_node" );
+    clp.setOption( "repeat", &num_repeat, "Number of applies to average" );
+    clp.setOption( "json-out-file", &json_file,
+                   "Write the results to this file instead of stdout" );
+    clp.setOption( "threaded", "serial", &threaded,
+                   "Use the threaded local search" );
+    clp.setOption( "weak", "strong", &weak,
+                   "Scale the number of cells in z with the number of ranks" );
+    if ( Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL !=
+         clp.parse( argc, argv ) )
+    {
+        return 1;
+    }
+
+    std::vector<std::string> operators = splitList( operators_list );
+    if ( 1 == operators.size() && "all" == operators[0] )
+    {
+        operators = {"consistent_interpolation", "l2_projection", "spline",
+                     "mls", "node_to_node"};
+    }
+    std::vector<std::string> cells = splitList( cells_list );
+
+    bool success = true;
+    try
+    {
+        std::ostringstream json;
+        json << "{\n"
+             << "  \"benchmark\": \"DataTransferKit operators\",\n"
+             << "  \"num_ranks\": " << comm->getSize() << ",\n"
+             << "  \"threaded_local_search\": "
+             << ( threaded ? "true" : "false" ) << ",\n"
+             << "  \"weak_scaling\": " << ( weak ? "true" : "false" ) << ",\n"
+             << "  \"num_apply\": " << num_repeat << ",\n"
+             << "  \"runs\": [";
+
+        int run = 0;
+        for ( auto &cell_entry : cells )
+        {
+            int num_cells = std::stoi( cell_entry );
+            int num_z_cells = weak ? num_cells * comm->getSize() : num_cells;
+
+            for ( auto &op : operators )
+            {
+                // Build the meshes.
+                int extra_cells = ( "node_to_node" == op ) ? 0 : 1;
+                DataTransferKit::UnitTest::ReferenceHexMesh source_mesh(
+                    comm, 0.0, 1.0, num_cells, 0.0, 1.0, num_cells, 0.0,
+                    num_z_cells / Teuchos::as<double>( num_cells ),
+                    num_z_cells );
+                DataTransferKit::UnitTest::ReferenceHexMesh target_mesh(
+                    comm, 0.0, 1.0, num_cells + extra_cells, 0.0, 1.0,
+                    num_cells + extra_cells, 0.0,
+                    num_z_cells / Teuchos::as<double>( num_cells ),
+                    num_z_cells + extra_cells );
+
+                // Build the fields.
+                auto source_field = source_mesh.nodalField( 1 );
+                writeSourceData( source_mesh, *source_field );
+                Teuchos::RCP<DataTransferKit::FieldMultiVector> source_vector =
+                    Teuchos::rcp( new DataTransferKit::FieldMultiVector(
+                        comm, source_field ) );
+                auto target_field = target_mesh.nodalField( 1 );
+                Teuchos::RCP<DataTransferKit::FieldMultiVector> target_vector =
+                    Teuchos::rcp( new DataTransferKit::FieldMultiVector(
+                        comm, target_field ) );
+
+                // Build the operator.
+                DataTransferKit::MapOperatorFactory factory;
+                auto map_op = factory.create(
+                    source_vector->getMap(), target_vector->getMap(),
+                    *operatorParameters( op, threaded ) );
+
+                // Time the setup.
+                resetPhaseTimers();
+                comm->barrier();
+                double start = Teuchos::Time::wallTime();
+                map_op->setup( source_mesh.functionSpace(),
+                               target_mesh.functionSpace() );
+                double setup_time = Teuchos::Time::wallTime() - start;
+
+                // Time the apply.
+                comm->barrier();
+                start = Teuchos::Time::wallTime();
+                for ( int r = 0; r < num_repeat; ++r )
+                {
+                    map_op->apply( *source_vector, *target_vector );
+                }
+                double apply_time = ( Teuchos::Time::wallTime() - start ) /
+                                    std::max( num_repeat, 1 );
+
+                // Reduce the phase times over the ranks.
+                int num_phases = phase_names.size();
+                Teuchos::Array<double> local_times( num_phases );
+                for ( int p = 0; p < num_phases - 2; ++p )
+                {
+                    local_times[p] = localPhaseTime( phase_names[p] );
+                }
+                local_times[num_phases - 2] = setup_time;
+                local_times[num_phases - 1] = apply_time;
+                Teuchos::Array<double> times( num_phases );
+                Teuchos::reduceAll( *comm, Teuchos::REDUCE_MAX, num_phases,
+                                    local_times.getRawPtr(),
+                                    times.getRawPtr() );
+
+                // Add the run to the results.
+                json << ( run ? "," : "" ) << "\n    {\n"
+                     << "      \"operator\": \"" << op << "\",\n"
+                     << "      \"source_cells\": [" << num_cells << ", "
+                     << num_cells << ", " << num_z_cells << "],\n"
+                     << "      \"target_cells\": ["
+                     << num_cells + extra_cells << ", "
+                     << num_cells + extra_cells << ", "
+                     << num_z_cells + extra_cells << "],\n"
+                     << "      \"phases\": {";
+                for ( int p = 0; p < num_phases; ++p )
+                {
+                    json << ( p ? "," : "" ) << "\n        \""
+                         << phase_names[p] << "\": " << times[p];
+                }
+                json << "\n      }\n    }";
+                ++run;
+            }
+        }
+        json << "\n  ]\n}\n";
+
+        // Write the results.
+        if ( 0 == comm->getRank() )
+        {
+            if ( json_file.empty() )
+            {
+                std::cout << json.str();
+            }
+            else
+            {
+                std::ofstream out( json_file );
+                out << json.str();
+            }
+        }
+    }
+    TEUCHOS_STANDARD_CATCH_STATEMENTS( true, std::cerr, success );
+
+    return success ? 0 : 1;
+}
+
+//---------------------------------------------------------------------------//
+// end operator_benchmark.cpp
+//---------------------------------------------------------------------------//
@@ -60,6 +60,13 @@ namespace DataTransferKit
  * The CenterDistributor distributes the centers to their target
  * processes. In addition, it saves that communication plan to move source
  * field values to the same destination processes.
+ *
+ * By default each target process is described by a single bounding box
+ * expanded by the radius. If cells are used, each target process also
+ * publishes the set of cells of a uniform grid occupied by its centers,
+ * with the cell size no smaller than the expanded radius. Source centers
+ * are then only sent to a process if they are in or adjacent to one of its
+ * occupied cells. The cells are identified by their Morton codes.
  */
 //---------------------------------------------------------------------------//
 template <int DIM>
@@ -71,7 +78,8 @@ class CenterDistributor
                        const Teuchos::ArrayView<const double> &source_centers,
                        const Teuchos::ArrayView<const double> &target_centers,
                        const double radius,
-                       Teuchos::Array<double> &target_decomp_source_centers );
+                       Teuchos::Array<double> &target_decomp_source_centers,
+                       const bool use_cells = false );
 
     // Get the number of source centers that will be distributed from this
     // process.
@@ -92,6 +100,36 @@ class CenterDistributor
     CloudDomain<DIM> localCloudDomain(
         const Teuchos::ArrayView<const double> &target_centers ) const;
 
+    // Gather the grids and occupied cells of the neighboring target
+    // processes.
+    void
+    gatherCells( const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+                 const Teuchos::ArrayView<const double> &target_centers,
+                 const double cell_size,
+                 const CloudDomain<DIM> &local_source_domain,
+                 const Teuchos::Array<CloudDomain<DIM>> &global_target_domains,
+                 const Teuchos::Array<int> &neighbor_ranks,
+                 Teuchos::Array<double> &neighbor_grids,
+                 Teuchos::Array<int> &neighbor_offsets,
+                 Teuchos::Array<unsigned long long> &neighbor_cells ) const;
+
+    // Compute the grid and the occupied cells of the local set of centers.
+    void buildCells( const Teuchos::ArrayView<const double> &centers,
+                     const double cell_size, Teuchos::Array<double> &grid,
+                     Teuchos::Array<unsigned long long> &cells ) const;
+
+    // Determine if a point is in or adjacent to a set of occupied cells.
+    bool pointInCells(
+        const Teuchos::ArrayView<const double> &point,
+        const Teuchos::ArrayView<const double> &grid,
+        const Teuchos::ArrayView<const unsigned long long> &cells ) const;
+
+    // Compute the Morton code of a cell.
+    unsigned long long mortonCode( const long long cell[DIM] ) const;
+
+    // Get the number of bits in each dimension of a Morton code.
+    static int mortonBits() { return ( 63 / DIM < 31 ) ? 63 / DIM : 31; }
+
   private:
     // Distributor.
     Teuchos::RCP<Tpetra::Distributor> d_distributor;
@@ -42,10 +42,13 @@
 #define DTK_CENTERDISTRIBUTOR_IMPL_HPP
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <utility>
 
 #include <Teuchos_Array.hpp>
 #include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_TimeMonitor.hpp>
 
 #include "DTK_DBC.hpp"
 
@@ -54,15 +57,23 @@ namespace DataTransferKit
 //---------------------------------------------------------------------------//
 /*!
  * \brief Constructor.
+ *
+ * \param use_cells If true, filter the source centers with the cells
+ * occupied by the target centers of each process in addition to the target
+ * process bounding boxes.
  */
 template <int DIM>
 CenterDistributor<DIM>::CenterDistributor(
     const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
     const Teuchos::ArrayView<const double> &source_centers,
     const Teuchos::ArrayView<const double> &target_centers, const double radius,
-    Teuchos::Array<double> &target_decomp_source_centers )
+    Teuchos::Array<double> &target_decomp_source_centers, const bool use_cells )
     : d_distributor( new Tpetra::Distributor( comm ) )
 {
+    auto timer =
+        Teuchos::TimeMonitor::getNewCounter( "DTK: Center Distribution" );
+    Teuchos::TimeMonitor monitor( *timer );
+
     DTK_REQUIRE( 0 == source_centers.size() % DIM );
     DTK_REQUIRE( 0 == target_centers.size() % DIM );
 
@@ -97,17 +108,46 @@ CenterDistributor<DIM>::CenterDistributor(
                 neighbor_ranks.push_back( i );
             }
         }
+
+        // If using cells, get the occupied cells of the neighbors.
+        Teuchos::Array<double> neighbor_grids;
+        Teuchos::Array<int> neighbor_offsets;
+        Teuchos::Array<unsigned long long> neighbor_cells;
+        if ( use_cells )
+        {
+            gatherCells( comm, target_centers, radius_expand,
+                         local_source_domain, global_target_domains,
+                         neighbor_ranks, neighbor_grids, neighbor_offsets,
+                         neighbor_cells );
+        }
         global_target_domains.clear();
+        int grid_size = 2 * DIM + 1;
+        Teuchos::ArrayView<const double> neighbor_grids_view =
+            neighbor_grids();
+        Teuchos::ArrayView<const unsigned long long> neighbor_cells_view =
+            neighbor_cells();
 
         // Find the procs to which the sources will be sent.
         Teuchos::ArrayView<const double> source_point;
+        bool in_neighbor = false;
         for ( unsigned source_id = 0; source_id < source_centers.size() / DIM;
               ++source_id )
         {
             source_point = source_centers.view( DIM * source_id, DIM );
             for ( unsigned b = 0; b < neighbor_target_domains.size(); ++b )
             {
-                if ( neighbor_target_domains[b].pointInDomain( source_point ) )
+                in_neighbor =
+                    neighbor_target_domains[b].pointInDomain( source_point );
+                if ( in_neighbor && use_cells )
+                {
+                    in_neighbor = pointInCells(
+                        source_point,
+                        neighbor_grids_view( grid_size * b, grid_size ),
+                        neighbor_cells_view( neighbor_offsets[b],
+                                             neighbor_offsets[b + 1] -
+                                                 neighbor_offsets[b] ) );
+                }
+                if ( in_neighbor )
                 {
                     export_procs.push_back( neighbor_ranks[b] );
                     d_export_ids.push_back( source_id );
@@ -151,6 +191,10 @@ void CenterDistributor<DIM>::distribute(
     const Teuchos::ArrayView<const T> &source_decomp_data,
     const Teuchos::ArrayView<T> &target_decomp_data ) const
 {
+    auto timer =
+        Teuchos::TimeMonitor::getNewCounter( "DTK: Center Distribution" );
+    Teuchos::TimeMonitor monitor( *timer );
+
     DTK_REQUIRE( d_num_imports == target_decomp_data.size() );
 
     // Unroll the source data to handle cases where single data points may
@@ -185,7 +229,7 @@ CloudDomain<DIM> CenterDistributor<DIM>::localCloudDomain(
         for ( int d = 0; d < DIM; ++d )
         {
             bounds[2 * d] = std::numeric_limits<double>::max();
-            bounds[2 * d + 1] = std::numeric_limits<double>::min();
+            bounds[2 * d + 1] = std::numeric_limits<double>::lowest();
         }
     }
 
@@ -204,6 +248,234 @@ CloudDomain<DIM> CenterDistributor<DIM>::localCloudDomain(
     return CloudDomain<DIM>( bounds.getRawPtr() );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Gather the grids and occupied cells of the neighboring target
+ * processes.
+ */
+template <int DIM>
+void CenterDistributor<DIM>::gatherCells(
+    const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+    const Teuchos::ArrayView<const double> &target_centers,
+    const double cell_size, const CloudDomain<DIM> &local_source_domain,
+    const Teuchos::Array<CloudDomain<DIM>> &global_target_domains,
+    const Teuchos::Array<int> &neighbor_ranks,
+    Teuchos::Array<double> &neighbor_grids,
+    Teuchos::Array<int> &neighbor_offsets,
+    Teuchos::Array<unsigned long long> &neighbor_cells ) const
+{
+    // Build the occupied cells of the local target centers.
+    Teuchos::Array<double> local_grid;
+    Teuchos::Array<unsigned long long> local_cells;
+    buildCells( target_centers, cell_size, local_grid, local_cells );
+
+    // Gather the grids and the source domains from all procs.
+    int comm_rank = comm->getRank();
+    int comm_size = comm->getSize();
+    int grid_size = 2 * DIM + 1;
+    Teuchos::Array<double> global_grids( grid_size * comm_size );
+    Teuchos::gatherAll<int, double>( *comm, grid_size, local_grid.getRawPtr(),
+                                     global_grids.size(),
+                                     global_grids.getRawPtr() );
+    Teuchos::Array<CloudDomain<DIM>> global_source_domains( comm_size );
+    Teuchos::gatherAll<int, CloudDomain<DIM>>(
+        *comm, 1, &local_source_domain, global_source_domains.size(),
+        global_source_domains.getRawPtr() );
+
+    // Send the local cells to the source procs that neighbor the local target
+    // domain. This is the same neighbor test the source procs use. Each
+    // packet is the target rank and a cell code.
+    Teuchos::Array<int> export_procs;
+    Teuchos::Array<unsigned long long> export_cells;
+    for ( int i = 0; i < comm_size; ++i )
+    {
+        if ( global_source_domains[i].checkForIntersection(
+                 global_target_domains[comm_rank] ) )
+        {
+            for ( auto cell : local_cells )
+            {
+                export_procs.push_back( i );
+                export_cells.push_back( comm_rank );
+                export_cells.push_back( cell );
+            }
+        }
+    }
+    Tpetra::Distributor cell_distributor( comm );
+    int num_import = cell_distributor.createFromSends( export_procs() );
+    Teuchos::Array<unsigned long long> import_cells( 2 * num_import );
+    Teuchos::ArrayView<const unsigned long long> export_cells_view =
+        export_cells();
+    cell_distributor.doPostsAndWaits( export_cells_view, 2, import_cells() );
+
+    // Sort the imported cells by target rank and then by code.
+    Teuchos::Array<std::pair<unsigned long long, unsigned long long>>
+        rank_cells( num_import );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        rank_cells[i] =
+            std::make_pair( import_cells[2 * i], import_cells[2 * i + 1] );
+    }
+    std::sort( rank_cells.begin(), rank_cells.end() );
+
+    // Group the cells by neighbor. The neighbor ranks are sorted.
+    int num_neighbors = neighbor_ranks.size();
+    neighbor_grids.resize( grid_size * num_neighbors );
+    neighbor_offsets.assign( num_neighbors + 1, 0 );
+    neighbor_cells.resize( num_import );
+    for ( int b = 0; b < num_neighbors; ++b )
+    {
+        neighbor_grids( grid_size * b, grid_size )
+            .assign( global_grids( grid_size * neighbor_ranks[b], grid_size ) );
+    }
+    Teuchos::Array<int>::const_iterator rank_it;
+    for ( int i = 0; i < num_import; ++i )
+    {
+        rank_it = std::lower_bound( neighbor_ranks.begin(),
+                                    neighbor_ranks.end(),
+                                    Teuchos::as<int>( rank_cells[i].first ) );
+        DTK_CHECK( rank_it != neighbor_ranks.end() );
+        DTK_CHECK( *rank_it == Teuchos::as<int>( rank_cells[i].first ) );
+        ++neighbor_offsets[std::distance( neighbor_ranks.begin(), rank_it ) +
+                           1];
+        neighbor_cells[i] = rank_cells[i].second;
+    }
+    for ( int b = 0; b < num_neighbors; ++b )
+    {
+        neighbor_offsets[b + 1] += neighbor_offsets[b];
+    }
+    DTK_ENSURE( num_import == neighbor_offsets.back() );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the grid and the occupied cells of the local set of
+ * centers. The grid is stored as (origin, number of cells, cell size).
+ */
+template <int DIM>
+void CenterDistributor<DIM>::buildCells(
+    const Teuchos::ArrayView<const double> &centers, const double cell_size,
+    Teuchos::Array<double> &grid,
+    Teuchos::Array<unsigned long long> &cells ) const
+{
+    CloudDomain<DIM> domain = localCloudDomain( centers );
+    Teuchos::ArrayView<const double> bounds = domain.bounds();
+
+    // The cells must be at least as large as the given size. Grow them if
+    // needed so that the cell indices fit in the Morton codes.
+    double max_cells = std::ldexp( 1.0, mortonBits() ) - 1.0;
+    double h = cell_size;
+    for ( int d = 0; d < DIM; ++d )
+    {
+        h = std::max( h, ( bounds[2 * d + 1] - bounds[2 * d] ) / max_cells );
+    }
+    if ( !( h > 0.0 ) )
+    {
+        h = 1.0;
+    }
+
+    // Build the grid.
+    grid.resize( 2 * DIM + 1 );
+    for ( int d = 0; d < DIM; ++d )
+    {
+        grid[d] = bounds[2 * d];
+        grid[DIM + d] =
+            std::min( std::floor( ( bounds[2 * d + 1] - bounds[2 * d] ) / h ) +
+                          1.0,
+                      max_cells );
+    }
+    grid[2 * DIM] = h;
+
+    // Compute the codes of the occupied cells.
+    int num_centers = centers.size() / DIM;
+    cells.resize( num_centers );
+    long long cell[DIM];
+    for ( int n = 0; n < num_centers; ++n )
+    {
+        for ( int d = 0; d < DIM; ++d )
+        {
+            cell[d] = static_cast<long long>(
+                std::floor( ( centers[DIM * n + d] - grid[d] ) / h ) );
+            cell[d] = std::min( cell[d],
+                                static_cast<long long>( grid[DIM + d] ) - 1 );
+            cell[d] = std::max( cell[d], 0LL );
+        }
+        cells[n] = mortonCode( cell );
+    }
+    std::sort( cells.begin(), cells.end() );
+    auto cells_end = std::unique( cells.begin(), cells.end() );
+    cells.resize( std::distance( cells.begin(), cells_end ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Determine if a point is in or adjacent to a set of occupied
+ * cells. As the cells are no smaller than the expanded radius, a point within
+ * the radius of a center is always in the cell of the center or one of its
+ * neighbors.
+ */
+template <int DIM>
+bool CenterDistributor<DIM>::pointInCells(
+    const Teuchos::ArrayView<const double> &point,
+    const Teuchos::ArrayView<const double> &grid,
+    const Teuchos::ArrayView<const unsigned long long> &cells ) const
+{
+    // Get the cell containing the point.
+    long long base[DIM];
+    for ( int d = 0; d < DIM; ++d )
+    {
+        base[d] = static_cast<long long>(
+            std::floor( ( point[d] - grid[d] ) / grid[2 * DIM] ) );
+    }
+
+    // Check the cell and its neighbors.
+    int num_neighbors = 1;
+    for ( int d = 0; d < DIM; ++d )
+    {
+        num_neighbors *= 3;
+    }
+    long long cell[DIM];
+    bool in_grid = true;
+    for ( int n = 0; n < num_neighbors; ++n )
+    {
+        in_grid = true;
+        for ( int d = 0, stride = 1; d < DIM; ++d, stride *= 3 )
+        {
+            cell[d] = base[d] + ( n / stride ) % 3 - 1;
+            in_grid =
+                in_grid && ( cell[d] >= 0 ) && ( cell[d] < grid[DIM + d] );
+        }
+        if ( in_grid &&
+             std::binary_search( cells.begin(), cells.end(),
+                                 mortonCode( cell ) ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the Morton code of a cell by interleaving the bits of its
+ * indices.
+ */
+template <int DIM>
+unsigned long long
+CenterDistributor<DIM>::mortonCode( const long long cell[DIM] ) const
+{
+    unsigned long long code = 0;
+    for ( int b = 0; b < mortonBits(); ++b )
+    {
+        for ( int d = 0; d < DIM; ++d )
+        {
+            code |=
+                ( ( static_cast<unsigned long long>( cell[d] ) >> b ) & 1ULL )
+                << ( DIM * b + d );
+        }
+    }
+    return code;
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
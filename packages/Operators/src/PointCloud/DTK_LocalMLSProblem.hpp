@@ -45,7 +45,6 @@
 
 #include <Teuchos_Array.hpp>
 #include <Teuchos_ArrayView.hpp>
-#include <Teuchos_SerialDenseMatrix.hpp>
 
 namespace DataTransferKit
 {
@@ -54,6 +53,11 @@ namespace DataTransferKit
  * \class LocalMLSProblem
  * \brief Local moving least square problem about a single target center using
  * quadratic polynomials.
+ *
+ * The polynomial basis is built one column at a time with an incremental
+ * Gram-Schmidt QR factorization. Columns that are linearly dependent on the
+ * ones already accepted are skipped. Coordinates beyond the spatial dimension
+ * are taken as zero so their columns are always skipped.
  */
 //---------------------------------------------------------------------------//
 template <class Basis, int DIM>
@@ -65,6 +69,53 @@ class LocalMLSProblem
     typedef RadialBasisPolicy<Basis> BP;
     //@}
 
+    /*!
+     * \brief Scratch space for solving local problems.
+     *
+     * The buffers grow to the largest support seen so repeated solves do not
+     * allocate. A workspace must not be shared between threads.
+     */
+    struct Workspace
+    {
+        Workspace()
+            : capacity( 0 )
+        { /* ... */
+        }
+
+        // Number of source centers the buffers are sized for.
+        int capacity;
+
+        // Source center coordinates packed by dimension (D,N).
+        Teuchos::Array<double> packed_sources;
+
+        // Radial basis weights (N).
+        Teuchos::Array<double> phi;
+
+        // Polynomial matrix (N,M) and its orthonormal factor (N,M).
+        Teuchos::Array<double> P;
+        Teuchos::Array<double> Q;
+
+        // Ids of the accepted polynomial coefficients (M).
+        Teuchos::Array<int> poly_ids;
+
+        // Polynomial coefficients of the target center (M).
+        Teuchos::Array<double> target_poly;
+
+        // Moment matrix and its LU factorization (M,M).
+        Teuchos::Array<double> A;
+        Teuchos::Array<double> LU_A;
+
+        // Right hand side, overwritten with the solution (M,N).
+        Teuchos::Array<double> b;
+
+        // LAPACK scratch space.
+        Teuchos::Array<double> s;
+        Teuchos::Array<int> ipiv;
+        Teuchos::Array<int> iwork;
+        Teuchos::Array<double> work;
+        Teuchos::Array<double> gelss_work;
+    };
+
     // Default constructor.
     LocalMLSProblem() { /* ... */}
 
@@ -80,14 +131,24 @@ class LocalMLSProblem
         return d_shape_function();
     }
 
+    // Compute the local shape function of num_sources source centers using
+    // the given workspace. Only raw pointers are used so this may be called
+    // concurrently with different workspaces.
+    static void computeShapeFunction( const double *target_center,
+                                      const unsigned *source_lids,
+                                      const int num_sources,
+                                      const double *source_centers,
+                                      const Basis &basis, const double radius,
+                                      Workspace &workspace,
+                                      double *shape_function );
+
   private:
     // Get a polynomial coefficient.
-    double polynomialCoefficient(
-        const int coeff, const Teuchos::ArrayView<const double> &center ) const;
+    static double polynomialCoefficient( const int coeff,
+                                         const double *point );
 
-    // Check if a matrix is full rank.
-    bool
-    isFullRank( const Teuchos::SerialDenseMatrix<int, double> &matrix ) const;
+    // Size a workspace for the given number of source centers.
+    static void reserve( Workspace &workspace, const int num_sources );
 
   private:
     // Moving least square shape function.
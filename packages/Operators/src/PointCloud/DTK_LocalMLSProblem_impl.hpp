@@ -42,17 +42,15 @@
 #define DTK_LOCALMLSPROBLEM_IMPL_HPP
 
 #include <algorithm>
-#include <functional>
+#include <cmath>
 #include <limits>
 
 #include "DTK_DBC.hpp"
-#include "DTK_EuclideanDistance.hpp"
 #include "DTK_LocalMLSProblem.hpp"
 #include "DTK_RadialBasisPolicy.hpp"
 
 #include <Teuchos_LAPACK.hpp>
-#include <Teuchos_SerialDenseSolver.hpp>
-#include <Teuchos_SerialDenseVector.hpp>
+#include <Teuchos_as.hpp>
 
 namespace DataTransferKit
 {
@@ -69,137 +67,185 @@ LocalMLSProblem<Basis, DIM>::LocalMLSProblem(
     : d_shape_function( source_lids.size() )
 {
     DTK_REQUIRE( 0 == source_centers.size() % DIM );
-    DTK_REQUIRE( 0 == target_center.size() % DIM );
+    DTK_REQUIRE( DIM == target_center.size() );
 
-    // Number of source centers supporting this target center.
-    int num_sources = source_lids.size();
-    int poly_size = 0;
-    Teuchos::SerialDenseMatrix<int, double> P;
-    Teuchos::SerialDenseVector<int, double> target_poly;
+    Workspace workspace;
+    computeShapeFunction( target_center.getRawPtr(), source_lids.getRawPtr(),
+                          source_lids.size(), source_centers.getRawPtr(),
+                          basis, radius, workspace,
+                          d_shape_function.getRawPtr() );
+}
 
-    // Make Phi.
-    Teuchos::SerialDenseMatrix<int, double> phi( num_sources, num_sources );
-    Teuchos::ArrayView<const double> source_center_view;
-    double dist = 0.0;
-    for ( int i = 0; i < num_sources; ++i )
-    {
-        source_center_view = source_centers( DIM * source_lids[i], DIM );
-        dist = EuclideanDistance<DIM>::distance(
-            target_center.getRawPtr(), source_center_view.getRawPtr() );
-        phi( i, i ) = BP::evaluateValue( basis, radius, dist );
-    }
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the local shape function of num_sources source centers
+ * using the given workspace.
+ */
+template <class Basis, int DIM>
+void LocalMLSProblem<Basis, DIM>::computeShapeFunction(
+    const double *target_center, const unsigned *source_lids,
+    const int num_sources, const double *source_centers, const Basis &basis,
+    const double radius, Workspace &workspace, double *shape_function )
+{
+    DTK_REQUIRE( 0 <= num_sources );
 
-    // Make P.
-    Teuchos::Array<int> poly_ids( 1, 0 );
-    int poly_id = 0;
-    P.reshape( num_sources, poly_id + 1 );
-    for ( int i = 0; i < num_sources; ++i )
+    // Nothing to do if no source centers support this target center.
+    if ( 0 == num_sources )
     {
-        source_center_view = source_centers( DIM * source_lids[i], DIM );
-        P( i, poly_id ) = polynomialCoefficient( 0, source_center_view );
+        return;
     }
-    ++poly_id;
-
-    // Add polynomial columns until we are full rank.
-    bool full_rank = false;
+    reserve( workspace, num_sources );
+
+    // Make Phi. It is diagonal so only the diagonal is stored.
+    packRadialBasisNeighbors<DIM>( source_centers, source_lids, num_sources,
+                                   workspace.packed_sources.getRawPtr() );
+    BP::template evaluateValues<DIM>(
+        basis, radius, target_center, workspace.packed_sources.getRawPtr(),
+        num_sources, workspace.phi.getRawPtr() );
+
+    // Make P. Add polynomial columns in order and keep those that are not
+    // linearly dependent on the columns already accepted. Each candidate is
+    // orthogonalized against the accepted columns of Q with two passes of
+    // Gram-Schmidt and rejected if nothing beyond round-off is left. No more
+    // columns than sources can be accepted.
     int num_poly = 10;
-    int total_poly = std::min( num_poly, num_sources );
-    for ( int j = 1; j < total_poly; ++j )
+    double epsilon = std::numeric_limits<double>::epsilon();
+    int poly_size = 0;
+    for ( int j = 0; j < num_poly && poly_size < num_sources; ++j )
     {
-        // Add the next column.
-        P.reshape( num_sources, poly_id + 1 );
+        double *p_col = workspace.P.getRawPtr() + num_sources * poly_size;
+        double *q_col = workspace.Q.getRawPtr() + num_sources * poly_size;
+        double column_norm = 0.0;
         for ( int i = 0; i < num_sources; ++i )
         {
-            source_center_view = source_centers( DIM * source_lids[i], DIM );
-            P( i, poly_id ) = polynomialCoefficient( j, source_center_view );
+            p_col[i] = polynomialCoefficient(
+                j, source_centers + DIM * source_lids[i] );
+            q_col[i] = p_col[i];
+            column_norm += p_col[i] * p_col[i];
         }
+        column_norm = std::sqrt( column_norm );
 
-        // Check for rank deficiency.
-        full_rank = isFullRank( P );
+        for ( int pass = 0; pass < 2; ++pass )
+        {
+            for ( int k = 0; k < poly_size; ++k )
+            {
+                const double *q_k =
+                    workspace.Q.getRawPtr() + num_sources * k;
+                double dot = 0.0;
+                for ( int i = 0; i < num_sources; ++i )
+                {
+                    dot += q_k[i] * q_col[i];
+                }
+                for ( int i = 0; i < num_sources; ++i )
+                {
+                    q_col[i] -= dot * q_k[i];
+                }
+            }
+        }
 
-        // If we are full rank, add this coefficient.
-        if ( full_rank )
+        double residual_norm = 0.0;
+        for ( int i = 0; i < num_sources; ++i )
         {
-            poly_ids.push_back( j );
-            ++poly_id;
+            residual_norm += q_col[i] * q_col[i];
         }
+        residual_norm = std::sqrt( residual_norm );
 
-        // If we are rank deficient, remove the last column.
-        else
+        // If the column adds to the rank, add this coefficient.
+        if ( residual_norm > epsilon * num_sources * column_norm )
         {
-            P.reshape( num_sources, poly_id );
+            for ( int i = 0; i < num_sources; ++i )
+            {
+                q_col[i] /= residual_norm;
+            }
+            workspace.poly_ids[poly_size] = j;
+            ++poly_size;
         }
     }
+    DTK_CHECK( 0 < poly_size );
 
     // Make p.
-    poly_size = poly_ids.size();
-    target_poly.resize( poly_size );
-    for ( int i = 0; i < poly_size; ++i )
+    for ( int k = 0; k < poly_size; ++k )
     {
-        target_poly( i ) = polynomialCoefficient( poly_ids[i], target_center );
+        workspace.target_poly[k] =
+            polynomialCoefficient( workspace.poly_ids[k], target_center );
     }
 
-    // Construct b.
-    Teuchos::SerialDenseMatrix<int, double> b( poly_size, num_sources );
-    b.multiply( Teuchos::TRANS, Teuchos::NO_TRANS, 1.0, P, phi, 0.0 );
+    // Construct b = P^T Phi.
+    const double *P = workspace.P.getRawPtr();
+    double *b = workspace.b.getRawPtr();
+    for ( int i = 0; i < num_sources; ++i )
+    {
+        for ( int k = 0; k < poly_size; ++k )
+        {
+            b[k + poly_size * i] = P[i + num_sources * k] * workspace.phi[i];
+        }
+    }
 
-    // Construct the A matrix.
-    Teuchos::SerialDenseMatrix<int, double> A( poly_size, poly_size );
+    // Construct A = P^T Phi P and its one-norm.
+    double *A = workspace.A.getRawPtr();
+    double A_norm = 0.0;
+    for ( int l = 0; l < poly_size; ++l )
     {
-        // Build A.
-        Teuchos::SerialDenseMatrix<int, double> work( num_sources, poly_size );
-        work.multiply( Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, phi, P, 0.0 );
-        A.multiply( Teuchos::TRANS, Teuchos::NO_TRANS, 1.0, P, work, 0.0 );
+        double column_sum = 0.0;
+        for ( int k = 0; k < poly_size; ++k )
+        {
+            double value = 0.0;
+            for ( int i = 0; i < num_sources; ++i )
+            {
+                value += b[k + poly_size * i] * P[i + num_sources * l];
+            }
+            A[k + poly_size * l] = value;
+            column_sum += std::abs( value );
+        }
+        A_norm = std::max( A_norm, column_sum );
     }
 
     // Apply the inverse of the A matrix to b.
     Teuchos::LAPACK<int, double> lapack;
-    double A_rcond = std::numeric_limits<double>::epsilon();
-    Teuchos::Array<double> work( 4 * A.numCols() );
-    Teuchos::SerialDenseVector<int, double> s( poly_size );
+    double A_rcond = epsilon;
     int rank = 0;
     int info = 0;
 
     // Estimate the reciprocal of the condition number.
-    Teuchos::Array<int> ipiv( std::min( A.numRows(), A.numCols() ) );
-    Teuchos::SerialDenseMatrix<int, double> LU_A( A );
-    lapack.GETRF( LU_A.numRows(), LU_A.numCols(), LU_A.values(), LU_A.numRows(),
-                  ipiv.getRawPtr(), &info );
-    DTK_CHECK( 0 == info );
-
-    Teuchos::Array<int> iwork( A.numCols() );
-    lapack.GECON( '1', LU_A.numCols(), LU_A.values(), LU_A.numRows(),
-                  A.normOne(), &A_rcond, work.getRawPtr(), iwork.getRawPtr(),
-                  &info );
+    std::copy( A, A + poly_size * poly_size, workspace.LU_A.begin() );
+    lapack.GETRF( poly_size, poly_size, workspace.LU_A.getRawPtr(), poly_size,
+                  workspace.ipiv.getRawPtr(), &info );
     DTK_CHECK( 0 == info );
 
-    // Get the optimal work size.
-    lapack.GELSS( A.numRows(), A.numCols(), b.numCols(), A.values(),
-                  A.numRows(), b.values(), b.numRows(), s.values(), A_rcond,
-                  &rank, work.getRawPtr(), -1, &info );
+    lapack.GECON( '1', poly_size, workspace.LU_A.getRawPtr(), poly_size,
+                  A_norm, &A_rcond, workspace.work.getRawPtr(),
+                  workspace.iwork.getRawPtr(), &info );
     DTK_CHECK( 0 == info );
 
     // Apply the inverse of A to b.
-    work.resize( work[0] );
-    lapack.GELSS( A.numRows(), A.numCols(), b.numCols(), A.values(),
-                  A.numRows(), b.values(), b.numRows(), s.values(), A_rcond,
-                  &rank, work.getRawPtr(), work.size(), &info );
+    lapack.GELSS( poly_size, poly_size, num_sources, A, poly_size, b,
+                  poly_size, workspace.s.getRawPtr(), A_rcond, &rank,
+                  workspace.gelss_work.getRawPtr(), workspace.gelss_work.size(),
+                  &info );
     DTK_CHECK( 0 == info );
 
     // Construct the basis.
-    Teuchos::SerialDenseMatrix<int, double> shape_matrix(
-        Teuchos::View, d_shape_function.getRawPtr(), 1, 1,
-        d_shape_function.size() );
-    shape_matrix.multiply( Teuchos::TRANS, Teuchos::NO_TRANS, 1.0, target_poly,
-                           b, 0.0 );
+    for ( int i = 0; i < num_sources; ++i )
+    {
+        double value = 0.0;
+        for ( int k = 0; k < poly_size; ++k )
+        {
+            value += workspace.target_poly[k] * b[k + poly_size * i];
+        }
+        shape_function[i] = value;
+    }
 }
 
 //---------------------------------------------------------------------------//
 // Get a polynomial coefficient.
 template <class Basis, int DIM>
 double LocalMLSProblem<Basis, DIM>::polynomialCoefficient(
-    const int coeff, const Teuchos::ArrayView<const double> &center ) const
+    const int coeff, const double *point )
 {
+    // Pad the point to 3 dimensions with zeros.
+    double center[3] = {0.0, 0.0, 0.0};
+    std::copy( point, point + DIM, center );
+
     switch ( coeff )
     {
     // Linear.
@@ -240,46 +286,44 @@ double LocalMLSProblem<Basis, DIM>::polynomialCoefficient(
 }
 
 //---------------------------------------------------------------------------//
-// Check if a matrix is full rank.
+// Size a workspace for the given number of source centers.
 template <class Basis, int DIM>
-bool LocalMLSProblem<Basis, DIM>::isFullRank(
-    const Teuchos::SerialDenseMatrix<int, double> &matrix ) const
+void LocalMLSProblem<Basis, DIM>::reserve( Workspace &workspace,
+                                           const int num_sources )
 {
-    // Copy the matrix.
-    Teuchos::SerialDenseMatrix<int, double> A = matrix;
-
-    // Determine the full rank.
-    int full_rank = std::min( A.numRows(), A.numCols() );
+    if ( num_sources <= workspace.capacity )
+    {
+        return;
+    }
 
-    // Compute the singular value decomposition.
+    int num_poly = 10;
+    workspace.capacity = num_sources;
+    workspace.packed_sources.resize( DIM * num_sources );
+    workspace.phi.resize( num_sources );
+    workspace.P.resize( num_sources * num_poly );
+    workspace.Q.resize( num_sources * num_poly );
+    workspace.poly_ids.resize( num_poly );
+    workspace.target_poly.resize( num_poly );
+    workspace.A.resize( num_poly * num_poly );
+    workspace.LU_A.resize( num_poly * num_poly );
+    workspace.b.resize( num_poly * num_sources );
+    workspace.s.resize( num_poly );
+    workspace.ipiv.resize( num_poly );
+    workspace.iwork.resize( num_poly );
+    workspace.work.resize( 4 * num_poly );
+
+    // Get the optimal GELSS work size for the largest problem this workspace
+    // can hold. Smaller problems need no more than this.
     Teuchos::LAPACK<int, double> lapack;
-    Teuchos::Array<double> S( full_rank );
-    Teuchos::SerialDenseMatrix<int, double> U( A.numRows(), A.numRows() );
-    Teuchos::SerialDenseMatrix<int, double> VT( A.numCols(), A.numCols() );
-    Teuchos::Array<double> work( full_rank );
-    Teuchos::Array<double> rwork( full_rank );
+    double work_size = 0.0;
+    int rank = 0;
     int info = 0;
-    lapack.GESVD( 'A', 'A', A.numRows(), A.numCols(), A.values(), A.numRows(),
-                  S.getRawPtr(), U.values(), U.numRows(), VT.values(),
-                  VT.numRows(), work.getRawPtr(), -1, rwork.getRawPtr(),
+    lapack.GELSS( num_poly, num_poly, num_sources, workspace.A.getRawPtr(),
+                  num_poly, workspace.b.getRawPtr(), num_poly,
+                  workspace.s.getRawPtr(), -1.0, &rank, &work_size, -1,
                   &info );
     DTK_CHECK( 0 == info );
-
-    work.resize( work[0] );
-    rwork.resize( work.size() );
-    lapack.GESVD( 'A', 'A', A.numRows(), A.numCols(), A.values(), A.numRows(),
-                  S.getRawPtr(), U.values(), U.numRows(), VT.values(),
-                  VT.numRows(), work.getRawPtr(), work.size(),
-                  rwork.getRawPtr(), &info );
-    DTK_CHECK( 0 == info );
-
-    // Check the singular values. If they are greater than delta they count.
-    double epsilon = std::numeric_limits<double>::epsilon();
-    double delta = S[0] * epsilon;
-    int rank = std::count_if( S.begin(), S.end(),
-                              [=]( double s ) { return ( s > delta ); } );
-
-    return ( rank == full_rank );
+    workspace.gelss_work.resize( Teuchos::as<int>( work_size ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -139,12 +139,20 @@ class MovingLeastSquareReconstructionOperator : virtual public MapOperator
     // Basis radius for support.
     double d_radius;
 
+    // Flag for the center distributor type. True if the target processes
+    // are described by their occupied cells, false if by bounding boxes.
+    bool d_use_cells;
+
     // Domain entity topological dimension. Default is 0 (vertex).
     int d_domain_entity_dim;
 
     // Range entity topological dimension. Default is 0 (vertex).
     int d_range_entity_dim;
 
+    // Flag for threading the local search and the local problems when DTK is
+    // built with OpenMP.
+    bool d_threaded;
+
     // Coupling matrix.
     Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> d_coupling_matrix;
 };
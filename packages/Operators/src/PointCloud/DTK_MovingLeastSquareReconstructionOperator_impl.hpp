@@ -41,19 +41,24 @@
 #ifndef DTK_MOVINGLEASTSQUARERECONSTRUCTIONOPERATOR_IMPL_HPP
 #define DTK_MOVINGLEASTSQUARERECONSTRUCTIONOPERATOR_IMPL_HPP
 
+#include <algorithm>
+
 #include "DTK_BasicEntityPredicates.hpp"
 #include "DTK_CenterDistributor.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_LocalMLSProblem.hpp"
 #include "DTK_MovingLeastSquareReconstructionOperator.hpp"
-#include "DTK_PredicateComposition.hpp"
 #include "DTK_SplineInterpolationPairing.hpp"
+#include "DTK_ThreadedBlocks.hpp"
 
 #include <Teuchos_ArrayRCP.hpp>
 #include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_Ptr.hpp>
+#include <Teuchos_TimeMonitor.hpp>
+#include <Teuchos_as.hpp>
 
+#include <Tpetra_Map.hpp>
 #include <Tpetra_MultiVector.hpp>
 
 namespace DataTransferKit
@@ -70,8 +75,10 @@ MovingLeastSquareReconstructionOperator<Basis, DIM>::
     , d_use_knn( false )
     , d_knn( 0 )
     , d_radius( 0.0 )
+    , d_use_cells( false )
     , d_domain_entity_dim( 0 )
     , d_range_entity_dim( 0 )
+    , d_threaded( false )
 {
     // Determine if we are doing kNN search or radius search.
     if ( parameters.isParameter( "Type of Search" ) )
@@ -106,6 +113,27 @@ MovingLeastSquareReconstructionOperator<Basis, DIM>::
         d_radius = parameters.get<double>( "RBF Radius" );
     }
 
+    // Determine how the target processes are described when distributing
+    // the source centers.
+    if ( parameters.isParameter( "Center Distributor Type" ) )
+    {
+        if ( "Bounding Box" ==
+             parameters.get<std::string>( "Center Distributor Type" ) )
+        {
+            d_use_cells = false;
+        }
+        else if ( "Cells" ==
+                  parameters.get<std::string>( "Center Distributor Type" ) )
+        {
+            d_use_cells = true;
+        }
+        else
+        {
+            // Otherwise we got an invalid distributor type.
+            DTK_INSIST( false );
+        }
+    }
+
     // Get the topological dimension of the domain and range entities. This
     // map will use their centroids for the point cloud.
     if ( parameters.isParameter( "Domain Entity Dimension" ) )
@@ -116,6 +144,12 @@ MovingLeastSquareReconstructionOperator<Basis, DIM>::
     {
         d_range_entity_dim = parameters.get<int>( "Range Entity Dimension" );
     }
+
+    // Determine if the local search and local problems should be threaded.
+    if ( parameters.isParameter( "Threaded Local Search" ) )
+    {
+        d_threaded = parameters.get<bool>( "Threaded Local Search" );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -185,7 +219,7 @@ void MovingLeastSquareReconstructionOperator<Basis, DIM>::setupImpl(
     Teuchos::Array<double> dist_sources;
     CenterDistributor<DIM> distributor( comm, source_centers(),
                                         target_centers(), target_proximity,
-                                        dist_sources );
+                                        dist_sources, d_use_cells );
 
     // Gather the global ids of the source centers that are within the proximity
     // of
@@ -196,51 +230,103 @@ void MovingLeastSquareReconstructionOperator<Basis, DIM>::setupImpl(
                             dist_source_support_ids() );
 
     // Build the source/target pairings.
-    SplineInterpolationPairing<DIM> pairings( dist_sources, target_centers(),
-                                              d_use_knn, d_knn, d_radius );
+    SplineInterpolationPairing<DIM> pairings(
+        dist_sources, target_centers(), d_use_knn, d_knn, d_radius,
+        d_threaded );
+
+    auto timer = Teuchos::TimeMonitor::getNewCounter( "DTK: Matrix Fill" );
+    Teuchos::TimeMonitor monitor( *timer );
 
     // Build the basis.
     Teuchos::RCP<Basis> basis = BP::create();
 
-    // Build the interpolation matrix.
+    // Get the offsets of each target center's shape function values.
     Teuchos::ArrayRCP<SupportId> children_per_parent =
         pairings.childrenPerParent();
-    SupportId max_entries_per_row = *std::max_element(
-        children_per_parent.begin(), children_per_parent.end() );
-    d_coupling_matrix = Teuchos::rcp( new Tpetra::CrsMatrix<Scalar, LO, GO>(
-        range_map, max_entries_per_row ) );
-    Teuchos::ArrayView<const double> target_view;
-    Teuchos::Array<GO> indices( max_entries_per_row );
-    Teuchos::ArrayView<const double> values;
-    Teuchos::ArrayView<const unsigned> pair_gids;
-    int nn = 0;
     int local_num_tgt = target_support_ids.size();
+    Teuchos::Array<std::size_t> value_offsets( local_num_tgt + 1, 0 );
     for ( int i = 0; i < local_num_tgt; ++i )
     {
-        // If there is no support for this target center then do not build a
-        // local basis.
-        if ( 0 < pairings.childCenterIds( i ).size() )
-        {
-            // Get a view of this target center.
-            target_view = target_centers( i * DIM, DIM );
+        value_offsets[i + 1] = value_offsets[i] + children_per_parent[i];
+    }
 
-            // Build the local interpolation problem.
-            LocalMLSProblem<Basis, DIM> local_problem(
-                target_view, pairings.childCenterIds( i ), dist_sources, *basis,
-                pairings.parentSupportRadius( i ) );
+    // Solve the local problems. Targets are split into contiguous blocks
+    // and each block reuses one workspace for all of its problems. If
+    // requested and DTK is built with OpenMP the blocks are solved
+    // concurrently. The blocks only read through raw pointers so no
+    // reference counts are changed from the threads.
+    Teuchos::Array<double> values( value_offsets.back() );
+    const double *target_data = target_centers.getRawPtr();
+    const double *source_data = dist_sources.getRawPtr();
+    const std::size_t *child_offsets = pairings.childOffsets();
+    const unsigned *child_ids = pairings.childIds();
+    double *value_data = values.getRawPtr();
+    const Basis &basis_ref = *basis;
+    const int min_block_size = 256;
+    int num_blocks =
+        numThreadBlocks( local_num_tgt, min_block_size, d_threaded );
+    forEachBlock(
+        local_num_tgt, num_blocks,
+        [&]( const int, const int block_begin, const int block_end ) {
+            typename LocalMLSProblem<Basis, DIM>::Workspace workspace;
+            for ( int i = block_begin; i < block_end; ++i )
+            {
+                // If there is no support for this target center then do not
+                // build a local basis.
+                if ( 0 < children_per_parent[i] )
+                {
+                    LocalMLSProblem<Basis, DIM>::computeShapeFunction(
+                        target_data + i * DIM, child_ids + child_offsets[i],
+                        children_per_parent[i], source_data, basis_ref,
+                        pairings.parentSupportRadius( i ), workspace,
+                        value_data + value_offsets[i] );
+                }
+            }
+        } );
+
+    // Build the column map from the unique source support ids.
+    Teuchos::Array<GO> column_ids( dist_source_support_ids );
+    std::sort( column_ids.begin(), column_ids.end() );
+    column_ids.erase( std::unique( column_ids.begin(), column_ids.end() ),
+                      column_ids.end() );
+    Teuchos::RCP<const TpetraMap> column_map =
+        Tpetra::createNonContigMap<LO, GO>( column_ids(), comm );
+    Teuchos::Array<LO> source_columns( dist_source_support_ids.size() );
+    for ( int n = 0; n < dist_source_support_ids.size(); ++n )
+    {
+        source_columns[n] =
+            column_map->getLocalElement( dist_source_support_ids[n] );
+    }
 
-            // Get MLS shape function values for this target point.
-            values = local_problem.shapeFunction();
-            nn = values.size();
+    // Get the exact local row sizes.
+    LO num_rows = range_map->getNodeNumElements();
+    Teuchos::ArrayRCP<std::size_t> row_sizes( num_rows, 0 );
+    Teuchos::Array<LO> target_rows( local_num_tgt );
+    for ( int i = 0; i < local_num_tgt; ++i )
+    {
+        target_rows[i] = range_map->getLocalElement( target_support_ids[i] );
+        DTK_CHECK( Teuchos::OrdinalTraits<LO>::invalid() != target_rows[i] );
+        row_sizes[target_rows[i]] += children_per_parent[i];
+    }
 
-            // Populate the interpolation matrix row.
-            pair_gids = pairings.childCenterIds( i );
-            for ( int j = 0; j < nn; ++j )
+    // Build the interpolation matrix with static profile and local indices.
+    d_coupling_matrix = Teuchos::rcp( new Tpetra::CrsMatrix<Scalar, LO, GO>(
+        range_map, column_map, row_sizes.getConst(), Tpetra::StaticProfile ) );
+    Teuchos::Array<LO> indices;
+    Teuchos::ArrayView<const unsigned> pair_lids;
+    for ( int i = 0; i < local_num_tgt; ++i )
+    {
+        if ( 0 < children_per_parent[i] )
+        {
+            pair_lids = pairings.childCenterIds( i );
+            indices.resize( pair_lids.size() );
+            for ( int j = 0; j < pair_lids.size(); ++j )
             {
-                indices[j] = dist_source_support_ids[pair_gids[j]];
+                indices[j] = source_columns[pair_lids[j]];
             }
-            d_coupling_matrix->insertGlobalValues( target_support_ids[i],
-                                                   indices( 0, nn ), values );
+            d_coupling_matrix->insertLocalValues(
+                target_rows[i], indices(),
+                values( value_offsets[i], children_per_parent[i] ) );
         }
     }
     d_coupling_matrix->fillComplete( domain_map, range_map );
@@ -280,9 +366,8 @@ void MovingLeastSquareReconstructionOperator<Basis, DIM>::getNodeCoordsAndIds(
     {
         LocalEntityPredicate local_predicate(
             space->entitySet()->communicator()->getRank() );
-        PredicateFunction predicate = PredicateComposition::And(
-            space->selectFunction(), local_predicate.getFunction() );
-        iterator = space->entitySet()->entityIterator( entity_dim, predicate );
+        iterator = space->selectedEntityIterator(
+            entity_dim, local_predicate.getFunction() );
     }
 
     // Extract the coordinates and support ids of the nodes.
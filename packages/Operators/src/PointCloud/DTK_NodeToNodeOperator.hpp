@@ -128,6 +128,9 @@ class NodeToNodeOperator : virtual public MapOperator
                               Teuchos::ArrayRCP<GO> &support_ids ) const;
 
   private:
+    // Flag for threading the local search when DTK is built with OpenMP.
+    bool d_threaded;
+
     // Exporter
     Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> d_coupling_matrix;
 };
@@ -46,13 +46,13 @@
 #include "DTK_DBC.hpp"
 #include "DTK_EuclideanDistance.hpp"
 #include "DTK_NodeToNodeOperator.hpp"
-#include "DTK_PredicateComposition.hpp"
 #include "DTK_SplineInterpolationPairing.hpp"
 
 #include <Teuchos_ArrayRCP.hpp>
 #include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_Ptr.hpp>
+#include <Teuchos_TimeMonitor.hpp>
 
 #include <Tpetra_MultiVector.hpp>
 
@@ -66,7 +66,13 @@ NodeToNodeOperator<DIM>::NodeToNodeOperator(
     const Teuchos::RCP<const TpetraMap> &range_map,
     const Teuchos::ParameterList &parameters )
     : Base( domain_map, range_map )
-{ /* ... */
+    , d_threaded( false )
+{
+    // Determine if the local search should be threaded.
+    if ( parameters.isParameter( "Threaded Local Search" ) )
+    {
+        d_threaded = parameters.get<bool>( "Threaded Local Search" );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -119,7 +125,10 @@ void NodeToNodeOperator<DIM>::setupImpl(
     // Build the source/target pairings by finding the nearest neighbor - this
     // should be the exact same node.
     SplineInterpolationPairing<DIM> pairings( dist_sources, target_centers(),
-                                              true, 1, 0.0 );
+                                              true, 1, 0.0, d_threaded );
+
+    auto timer = Teuchos::TimeMonitor::getNewCounter( "DTK: Matrix Fill" );
+    Teuchos::TimeMonitor monitor( *timer );
 
     // Build the coupling matrix.
     d_coupling_matrix =
@@ -190,9 +199,8 @@ void NodeToNodeOperator<DIM>::getNodeCoordsAndIds(
     {
         LocalEntityPredicate local_predicate(
             space->entitySet()->communicator()->getRank() );
-        PredicateFunction predicate = PredicateComposition::And(
-            space->selectFunction(), local_predicate.getFunction() );
-        iterator = space->entitySet()->entityIterator( 0, predicate );
+        iterator =
+            space->selectedEntityIterator( 0, local_predicate.getFunction() );
     }
 
     // Extract the coordinates and support ids of the nodes.
@@ -41,6 +41,8 @@
 #ifndef DTK_RADIALBASISPOLICY_HPP
 #define DTK_RADIALBASISPOLICY_HPP
 
+#include <cmath>
+
 #include <Teuchos_RCP.hpp>
 
 namespace DataTransferKit
@@ -59,6 +61,55 @@ struct UndefinedRadialBasisPolicy
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Pack the coordinates of a set of neighbors by dimension.
+ *
+ * Coordinate d of neighbor j is written to packed[d * num_neighbors + j] as
+ * expected by the batched basis evaluations.
+ */
+template <int DIM>
+inline void packRadialBasisNeighbors( const double *centers,
+                                      const unsigned *neighbor_ids,
+                                      const int num_neighbors, double *packed )
+{
+    for ( int d = 0; d < DIM; ++d )
+    {
+        for ( int j = 0; j < num_neighbors; ++j )
+        {
+            packed[d * num_neighbors + j] = centers[DIM * neighbor_ids[j] + d];
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate a radial basis about a center at a packed block of
+ * neighbors.
+ *
+ * The distance and basis evaluations are fused in one loop over the
+ * neighbors. The bases evaluate inline without branches so the loop
+ * vectorizes for every basis and dimension.
+ */
+template <int DIM, class RadialBasis>
+inline void evaluateRadialBasisValues( const RadialBasis &basis,
+                                       const double radius,
+                                       const double *center,
+                                       const double *neighbors,
+                                       const int num_neighbors, double *values )
+{
+    for ( int j = 0; j < num_neighbors; ++j )
+    {
+        double dist2 = 0.0;
+        for ( int d = 0; d < DIM; ++d )
+        {
+            double dx = center[d] - neighbors[d * num_neighbors + j];
+            dist2 += dx * dx;
+        }
+        values[j] = basis.evaluateValue( radius, std::sqrt( dist2 ) );
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \class RadialBasisPolicy \brief Traits/policy class for compactly supported
@@ -94,6 +145,18 @@ class RadialBasisPolicy
         UndefinedRadialBasisPolicy<RadialBasis>::notDefined();
         return 0.0;
     }
+
+    //! Compute the values of the basis about a center at a packed block of
+    //! neighbors.
+    template <int DIM>
+    static inline void evaluateValues( const RadialBasis &basis,
+                                       const double radius,
+                                       const double *center,
+                                       const double *neighbors,
+                                       const int num_neighbors, double *values )
+    {
+        UndefinedRadialBasisPolicy<RadialBasis>::notDefined();
+    }
 };
 
 //---------------------------------------------------------------------------//
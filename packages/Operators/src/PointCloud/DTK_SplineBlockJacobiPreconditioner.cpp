@@ -0,0 +1,185 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   DTK_SplineBlockJacobiPreconditioner.cpp
+ * \author Stuart R. Slattery
+ * \brief  Block Jacobi preconditioner for the spline coefficient matrix.
+ */
+//---------------------------------------------------------------------------//
+
+#include "DTK_SplineBlockJacobiPreconditioner.hpp"
+#include "DTK_DBC.hpp"
+
+#include <Teuchos_ArrayRCP.hpp>
+#include <Teuchos_LAPACK.hpp>
+#include <Teuchos_OrdinalTraits.hpp>
+
+#include <algorithm>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ */
+SplineBlockJacobiPreconditioner::SplineBlockJacobiPreconditioner(
+    const Teuchos::RCP<const Tpetra::CrsMatrix<double, int, SupportId>>
+        &basis_matrix,
+    const Teuchos::RCP<const Tpetra::Map<int, SupportId>> &operator_map,
+    const int block_size )
+    : d_map( operator_map )
+{
+    DTK_REQUIRE( basis_matrix->isFillComplete() );
+    DTK_REQUIRE( block_size > 0 );
+
+    // Split the local rows into contiguous blocks.
+    int num_rows = d_map->getNodeNumElements();
+    d_block_offsets.push_back( 0 );
+    d_factor_offsets.push_back( 0 );
+    while ( d_block_offsets.back() < num_rows )
+    {
+        int size = std::min( block_size, num_rows - d_block_offsets.back() );
+        d_block_offsets.push_back( d_block_offsets.back() + size );
+        d_factor_offsets.push_back( d_factor_offsets.back() + size * size );
+    }
+    d_factors.resize( d_factor_offsets.back(), 0.0 );
+    d_pivots.resize( num_rows );
+
+    // Assemble the diagonal blocks from the rows of the basis matrix.
+    int num_blocks = d_block_offsets.size() - 1;
+    Teuchos::Array<int> row_block( num_rows );
+    for ( int b = 0; b < num_blocks; ++b )
+    {
+        std::fill( row_block.begin() + d_block_offsets[b],
+                   row_block.begin() + d_block_offsets[b + 1], b );
+    }
+    Teuchos::ArrayView<const int> row_indices;
+    Teuchos::ArrayView<const double> row_values;
+    for ( int i = 0; i < num_rows; ++i )
+    {
+        int b = row_block[i];
+        int size = d_block_offsets[b + 1] - d_block_offsets[b];
+        double *block = &d_factors[d_factor_offsets[b]];
+        int bi = i - d_block_offsets[b];
+
+        int matrix_row = basis_matrix->getRowMap()->getLocalElement(
+            d_map->getGlobalElement( i ) );
+        if ( Teuchos::OrdinalTraits<int>::invalid() != matrix_row )
+        {
+            basis_matrix->getLocalRowView( matrix_row, row_indices,
+                                           row_values );
+            for ( int j = 0; j < row_indices.size(); ++j )
+            {
+                int col = d_map->getLocalElement(
+                    basis_matrix->getColMap()->getGlobalElement(
+                        row_indices[j] ) );
+                if ( d_block_offsets[b] <= col &&
+                     col < d_block_offsets[b + 1] )
+                {
+                    block[( col - d_block_offsets[b] ) * size + bi] +=
+                        row_values[j];
+                }
+            }
+        }
+
+        // Rows without a diagonal entry are preconditioned with the identity.
+        if ( 0.0 == block[bi * size + bi] )
+        {
+            block[bi * size + bi] = 1.0;
+        }
+    }
+
+    // Factor the blocks.
+    Teuchos::LAPACK<int, double> lapack;
+    int info = 0;
+    for ( int b = 0; b < num_blocks; ++b )
+    {
+        int size = d_block_offsets[b + 1] - d_block_offsets[b];
+        lapack.GETRF( size, size, &d_factors[d_factor_offsets[b]], size,
+                      &d_pivots[d_block_offsets[b]], &info );
+        DTK_INSIST( 0 == info );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Apply operation.
+void SplineBlockJacobiPreconditioner::apply(
+    const Tpetra::MultiVector<double, int, SupportId> &X,
+    Tpetra::MultiVector<double, int, SupportId> &Y, Teuchos::ETransp mode,
+    double alpha, double beta ) const
+{
+    DTK_REQUIRE( Teuchos::NO_TRANS == mode );
+    DTK_REQUIRE( d_map->isSameAs( *( X.getMap() ) ) );
+    DTK_REQUIRE( d_map->isSameAs( *( Y.getMap() ) ) );
+    DTK_REQUIRE( X.getNumVectors() == Y.getNumVectors() );
+
+    // Solve each block for each vector.
+    int num_rows = d_block_offsets.back();
+    if ( 0 == num_rows )
+    {
+        return;
+    }
+    Teuchos::LAPACK<int, double> lapack;
+    int num_blocks = d_block_offsets.size() - 1;
+    Teuchos::Array<double> work( num_rows );
+    Teuchos::ArrayRCP<Teuchos::ArrayRCP<const double>> x_view = X.get2dView();
+    Teuchos::ArrayRCP<Teuchos::ArrayRCP<double>> y_view = Y.get2dViewNonConst();
+    int info = 0;
+    for ( unsigned n = 0; n < X.getNumVectors(); ++n )
+    {
+        std::copy( &x_view[n][0], &x_view[n][0] + num_rows, work.begin() );
+        for ( int b = 0; b < num_blocks; ++b )
+        {
+            int size = d_block_offsets[b + 1] - d_block_offsets[b];
+            lapack.GETRS( 'N', size, 1, &d_factors[d_factor_offsets[b]], size,
+                          &d_pivots[d_block_offsets[b]],
+                          &work[d_block_offsets[b]], size, &info );
+            DTK_CHECK( 0 == info );
+        }
+        for ( int i = 0; i < num_rows; ++i )
+        {
+            y_view[n][i] = ( 0.0 == beta )
+                               ? alpha * work[i]
+                               : alpha * work[i] + beta * y_view[n][i];
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// end DTK_SplineBlockJacobiPreconditioner.cpp
+//---------------------------------------------------------------------------//
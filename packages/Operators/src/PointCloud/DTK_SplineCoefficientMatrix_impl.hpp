@@ -42,10 +42,10 @@
 #define DTK_SPLINECOEFFICIENTMATRIX_IMPL_HPP
 
 #include "DTK_DBC.hpp"
-#include "DTK_EuclideanDistance.hpp"
 #include "DTK_SplineCoefficientMatrix.hpp"
 
 #include <Teuchos_Array.hpp>
+#include <Teuchos_TimeMonitor.hpp>
 
 namespace DataTransferKit
 {
@@ -62,6 +62,9 @@ SplineCoefficientMatrix<Basis, DIM>::SplineCoefficientMatrix(
     const Teuchos::ArrayView<const SupportId> &dist_source_center_gids,
     const SplineInterpolationPairing<DIM> &source_pairings, const Basis &basis )
 {
+    auto timer = Teuchos::TimeMonitor::getNewCounter( "DTK: Matrix Fill" );
+    Teuchos::TimeMonitor monitor( *timer );
+
     DTK_CHECK( 0 == source_centers.size() % DIM );
     DTK_CHECK( source_centers.size() / DIM == source_center_gids.size() );
     DTK_CHECK( 0 == dist_source_centers.size() % DIM );
@@ -99,9 +102,8 @@ SplineCoefficientMatrix<Basis, DIM>::SplineCoefficientMatrix(
         operator_map, max_entries_per_row ) );
     Teuchos::Array<SupportId> M_indices( max_entries_per_row );
     Teuchos::Array<double> values( max_entries_per_row );
-    int dj = 0;
+    Teuchos::Array<double> packed_neighbors( DIM * max_entries_per_row );
     Teuchos::ArrayView<const unsigned> source_neighbors;
-    double dist = 0.0;
     int nsn = 0;
     double radius = 0.0;
     for ( unsigned i = 0; i < num_source_centers; ++i )
@@ -113,15 +115,15 @@ SplineCoefficientMatrix<Basis, DIM>::SplineCoefficientMatrix(
         radius = source_pairings.parentSupportRadius( i );
 
         // Add the local basis contributions.
+        packRadialBasisNeighbors<DIM>(
+            dist_source_centers.getRawPtr(), source_neighbors.getRawPtr(), nsn,
+            packed_neighbors.getRawPtr() );
+        BP::template evaluateValues<DIM>(
+            basis, radius, &source_centers[di], packed_neighbors.getRawPtr(),
+            nsn, values.getRawPtr() );
         for ( int j = 0; j < nsn; ++j )
         {
-            dj = DIM * source_neighbors[j];
             M_indices[j] = dist_source_center_gids[source_neighbors[j]];
-
-            dist = EuclideanDistance<DIM>::distance( &source_centers[di],
-                                                     &dist_source_centers[dj] );
-
-            values[j] = BP::evaluateValue( basis, radius, dist );
         }
         d_M->insertGlobalValues( source_center_gids[i], M_indices( 0, nsn ),
                                  values( 0, nsn ) );
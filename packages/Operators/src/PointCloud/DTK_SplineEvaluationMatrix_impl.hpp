@@ -42,10 +42,10 @@
 #define DTK_SPLINEEVALUATIONMATRIX_IMPL_HPP
 
 #include "DTK_DBC.hpp"
-#include "DTK_EuclideanDistance.hpp"
 #include "DTK_SplineEvaluationMatrix.hpp"
 
 #include <Teuchos_Array.hpp>
+#include <Teuchos_TimeMonitor.hpp>
 
 namespace DataTransferKit
 {
@@ -63,6 +63,9 @@ SplineEvaluationMatrix<Basis, DIM>::SplineEvaluationMatrix(
     const Teuchos::ArrayView<const SupportId> &dist_source_center_gids,
     const SplineInterpolationPairing<DIM> &target_pairings, const Basis &basis )
 {
+    auto timer = Teuchos::TimeMonitor::getNewCounter( "DTK: Matrix Fill" );
+    Teuchos::TimeMonitor monitor( *timer );
+
     DTK_CHECK( 0 == target_centers.size() % DIM );
     DTK_CHECK( target_centers.size() / DIM == target_center_gids.size() );
     DTK_CHECK( 0 == dist_source_centers.size() % DIM );
@@ -98,9 +101,8 @@ SplineEvaluationMatrix<Basis, DIM>::SplineEvaluationMatrix(
         range_map, max_entries_per_row ) );
     Teuchos::Array<SupportId> N_indices( max_entries_per_row );
     Teuchos::Array<double> values( max_entries_per_row );
-    int dj = 0;
+    Teuchos::Array<double> packed_neighbors( DIM * max_entries_per_row );
     Teuchos::ArrayView<const unsigned> target_neighbors;
-    double dist = 0.0;
     int ntn = 0;
     double radius = 0.0;
     for ( unsigned i = 0; i < num_target_centers; ++i )
@@ -113,16 +115,15 @@ SplineEvaluationMatrix<Basis, DIM>::SplineEvaluationMatrix(
         radius = target_pairings.parentSupportRadius( i );
 
         // Add the local basis contributions.
+        packRadialBasisNeighbors<DIM>(
+            dist_source_centers.getRawPtr(), target_neighbors.getRawPtr(), ntn,
+            packed_neighbors.getRawPtr() );
+        BP::template evaluateValues<DIM>(
+            basis, radius, &target_centers[di], packed_neighbors.getRawPtr(),
+            ntn, values.getRawPtr() );
         for ( int j = 0; j < ntn; ++j )
         {
-            dj = DIM * target_neighbors[j];
-
             N_indices[j] = dist_source_center_gids[target_neighbors[j]];
-
-            dist = EuclideanDistance<DIM>::distance( &target_centers[di],
-                                                     &dist_source_centers[dj] );
-
-            values[j] = BP::evaluateValue( basis, radius, dist );
         }
 
         d_N->insertGlobalValues( target_center_gids[i], N_indices( 0, ntn ),
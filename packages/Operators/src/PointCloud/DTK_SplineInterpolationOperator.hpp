@@ -63,6 +63,12 @@ namespace DataTransferKit
  * The SplineInterpolationOperator is the top-level driver for parallel
  * interpolation
  * problems.
+ *
+ * With "Interpolation Type" set to "Global" (the default) the spline
+ * coefficients come from one global solve. With "Partition of Unity" the
+ * operator instead blends local spline problems on overlapping patches of
+ * radius "Patch Radius" and assembles the result into a single sparse
+ * matrix, so setup and apply need no global solve.
  */
 //---------------------------------------------------------------------------//
 template <class Basis, int DIM>
@@ -136,6 +142,12 @@ class SplineInterpolationOperator : virtual public MapOperator
         Teuchos::RCP<const Root> &M, Teuchos::RCP<const Root> &Q,
         Teuchos::RCP<const Root> &N ) const;
 
+    // Build the partition of unity interpolation operator.
+    void buildPartitionOfUnityOperator(
+        const Teuchos::RCP<FunctionSpace> &domain_space,
+        const Teuchos::RCP<FunctionSpace> &range_space,
+        Teuchos::RCP<const Root> &A ) const;
+
   private:
     // Extract node coordinates and ids from an iterator.
     void getNodeCoordsAndIds( const Teuchos::RCP<FunctionSpace> &space,
@@ -153,12 +165,34 @@ class SplineInterpolationOperator : virtual public MapOperator
     // Basis radius.
     double d_radius;
 
+    // Flag for the center distributor type. True if the target processes
+    // are described by their occupied cells, false if by bounding boxes.
+    bool d_use_cells;
+
+    // Flag for preconditioning the coefficient solve with a block Jacobi
+    // preconditioner built from the local basis blocks.
+    bool d_use_block_jacobi;
+
+    // Number of local rows in each block Jacobi block.
+    int d_block_jacobi_size;
+
+    // Flag for partition of unity interpolation. True if the local patch
+    // problems are blended, false if the spline is solved globally.
+    bool d_use_partition_of_unity;
+
+    // Partition of unity patch radius.
+    double d_patch_radius;
+
     // Domain entity topological dimension. Default is 0 (vertex).
     int d_domain_entity_dim;
 
     // Range entity topological dimension. Default is 0 (vertex).
     int d_range_entity_dim;
 
+    // Flag for threading the local searches and patch problems when DTK is
+    // built with OpenMP.
+    bool d_threaded;
+
     // Stratimikos parameter list.
     Teuchos::RCP<Teuchos::ParameterList> d_stratimikos_list;
 
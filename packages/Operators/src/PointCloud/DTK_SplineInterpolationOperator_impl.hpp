@@ -44,11 +44,12 @@
 #include "DTK_BasicEntityPredicates.hpp"
 #include "DTK_CenterDistributor.hpp"
 #include "DTK_DBC.hpp"
-#include "DTK_PredicateComposition.hpp"
+#include "DTK_SplineBlockJacobiPreconditioner.hpp"
 #include "DTK_SplineCoefficientMatrix.hpp"
 #include "DTK_SplineEvaluationMatrix.hpp"
 #include "DTK_SplineInterpolationOperator.hpp"
 #include "DTK_SplineInterpolationPairing.hpp"
+#include "DTK_SplinePartitionOfUnityMatrix.hpp"
 #include "DTK_SplineProlongationOperator.hpp"
 
 #include <Teuchos_ArrayRCP.hpp>
@@ -60,7 +61,9 @@
 #include <BelosPseudoBlockGmresSolMgr.hpp>
 
 #include <Thyra_DefaultAddedLinearOp.hpp>
+#include <Thyra_DefaultInverseLinearOp.hpp>
 #include <Thyra_DefaultMultipliedLinearOp.hpp>
+#include <Thyra_DefaultPreconditioner.hpp>
 #include <Thyra_DefaultScaledAdjointLinearOp.hpp>
 #include <Thyra_LinearOpWithSolveFactoryHelpers.hpp>
 #include <Thyra_TpetraThyraWrappers.hpp>
@@ -80,8 +83,14 @@ SplineInterpolationOperator<Basis, DIM>::SplineInterpolationOperator(
     , d_use_knn( false )
     , d_knn( 0 )
     , d_radius( 0.0 )
+    , d_use_cells( false )
+    , d_use_block_jacobi( false )
+    , d_block_jacobi_size( 64 )
+    , d_use_partition_of_unity( false )
+    , d_patch_radius( 0.0 )
     , d_domain_entity_dim( 0 )
     , d_range_entity_dim( 0 )
+    , d_threaded( false )
 {
     // Determine if we are doing kNN search or radius search.
     if ( parameters.isParameter( "Type of Search" ) )
@@ -116,6 +125,81 @@ SplineInterpolationOperator<Basis, DIM>::SplineInterpolationOperator(
         d_radius = parameters.get<double>( "RBF Radius" );
     }
 
+    // Determine how the target processes are described when distributing
+    // the source centers.
+    if ( parameters.isParameter( "Center Distributor Type" ) )
+    {
+        if ( "Bounding Box" ==
+             parameters.get<std::string>( "Center Distributor Type" ) )
+        {
+            d_use_cells = false;
+        }
+        else if ( "Cells" ==
+                  parameters.get<std::string>( "Center Distributor Type" ) )
+        {
+            d_use_cells = true;
+        }
+        else
+        {
+            // Otherwise we got an invalid distributor type.
+            DTK_INSIST( false );
+        }
+    }
+
+    // Determine if the coefficient solve is preconditioned.
+    if ( parameters.isParameter( "Coefficient Preconditioner Type" ) )
+    {
+        if ( "None" ==
+             parameters.get<std::string>( "Coefficient Preconditioner Type" ) )
+        {
+            d_use_block_jacobi = false;
+        }
+        else if ( "Block Jacobi" ==
+                  parameters.get<std::string>(
+                      "Coefficient Preconditioner Type" ) )
+        {
+            d_use_block_jacobi = true;
+        }
+        else
+        {
+            // Otherwise we got an invalid preconditioner type.
+            DTK_INSIST( false );
+        }
+    }
+    if ( parameters.isParameter( "Block Jacobi Size" ) )
+    {
+        d_block_jacobi_size = parameters.get<int>( "Block Jacobi Size" );
+        DTK_REQUIRE( d_block_jacobi_size > 0 );
+    }
+
+    // Determine if the spline is solved globally or blended from local
+    // patch problems.
+    if ( parameters.isParameter( "Interpolation Type" ) )
+    {
+        if ( "Global" == parameters.get<std::string>( "Interpolation Type" ) )
+        {
+            d_use_partition_of_unity = false;
+        }
+        else if ( "Partition of Unity" ==
+                  parameters.get<std::string>( "Interpolation Type" ) )
+        {
+            d_use_partition_of_unity = true;
+        }
+        else
+        {
+            // Otherwise we got an invalid interpolation type.
+            DTK_INSIST( false );
+        }
+    }
+
+    // If we are blending patches get the patch radius.
+    if ( d_use_partition_of_unity )
+    {
+        DTK_REQUIRE( parameters.isParameter( "Patch Radius" ) );
+        d_patch_radius = parameters.get<double>( "Patch Radius" );
+        DTK_REQUIRE( d_patch_radius > 0.0 );
+    }
+
     // Get the topological dimension of the domain and range entities. This
     // map will use their centroids for the point cloud.
     if ( parameters.isParameter( "Domain Entity Dimension" ) )
@@ -127,6 +211,12 @@ SplineInterpolationOperator<Basis, DIM>::SplineInterpolationOperator(
         d_range_entity_dim = parameters.get<int>( "Range Entity Dimension" );
     }
 
+    // Determine if the local searches should be threaded.
+    if ( parameters.isParameter( "Threaded Local Search" ) )
+    {
+        d_threaded = parameters.get<bool>( "Threaded Local Search" );
+    }
+
     // Get the stratimikos parameters if they exist.
     if ( parameters.isSublist( "Stratimikos" ) )
     {
@@ -151,6 +241,31 @@ void SplineInterpolationOperator<Basis, DIM>::setupImpl(
     const Teuchos::RCP<const typename Base::TpetraMap> range_map =
         this->getRangeMap();
 
+    // If blending local patch problems the interpolation operator is
+    // assembled directly.
+    if ( d_use_partition_of_unity )
+    {
+        Teuchos::RCP<const Root> A;
+        buildPartitionOfUnityOperator( domain_space, range_space, A );
+
+        // Create an abstract wrapper for A.
+        Teuchos::RCP<const Thyra::VectorSpaceBase<Scalar>>
+            thyra_range_vector_space_A =
+                Thyra::createVectorSpace<Scalar>( A->getRangeMap() );
+        Teuchos::RCP<const Thyra::VectorSpaceBase<Scalar>>
+            thyra_domain_vector_space_A =
+                Thyra::createVectorSpace<Scalar>( A->getDomainMap() );
+        Teuchos::RCP<const Thyra::TpetraLinearOp<Scalar, LO, GO>> thyra_A =
+            Teuchos::rcp( new Thyra::TpetraLinearOp<Scalar, LO, GO>() );
+        Teuchos::rcp_const_cast<Thyra::TpetraLinearOp<Scalar, LO, GO>>(
+            thyra_A )
+            ->constInitialize( thyra_range_vector_space_A,
+                               thyra_domain_vector_space_A, A );
+        d_coupling_matrix = thyra_A;
+        DTK_ENSURE( Teuchos::nonnull( d_coupling_matrix ) );
+        return;
+    }
+
     // Prolongation operator.
     Teuchos::RCP<const Root> S;
 
@@ -272,8 +387,41 @@ void SplineInterpolationOperator<Basis, DIM>::setupImpl(
     builder.setParameterList( d_stratimikos_list );
     Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<Scalar>> factory =
         Thyra::createLinearSolveStrategy( builder );
-    Teuchos::RCP<const Thyra::LinearOpBase<Scalar>> thyra_C_inv =
-        Thyra::inverse<Scalar>( *factory, thyra_C );
+    Teuchos::RCP<const Thyra::LinearOpBase<Scalar>> thyra_C_inv;
+    if ( d_use_block_jacobi )
+    {
+        // Factor the diagonal blocks of M once here. The preconditioner is
+        // kept with the solver so each apply only does the triangular solves
+        // in each iteration.
+        Teuchos::RCP<const Root> J =
+            Teuchos::rcp( new SplineBlockJacobiPreconditioner(
+                Teuchos::rcp_dynamic_cast<
+                    const Tpetra::CrsMatrix<Scalar, LO, GO>>( M, true ),
+                S->getRangeMap(), d_block_jacobi_size ) );
+
+        // Create an abstract wrapper for J.
+        Teuchos::RCP<const Thyra::VectorSpaceBase<Scalar>>
+            thyra_vector_space_J =
+                Thyra::createVectorSpace<Scalar>( J->getRangeMap() );
+        Teuchos::RCP<const Thyra::TpetraLinearOp<Scalar, LO, GO>> thyra_J =
+            Teuchos::rcp( new Thyra::TpetraLinearOp<Scalar, LO, GO>() );
+        Teuchos::rcp_const_cast<Thyra::TpetraLinearOp<Scalar, LO, GO>>(
+            thyra_J )
+            ->constInitialize( thyra_vector_space_J, thyra_vector_space_J,
+                               J );
+
+        // Create the preconditioned solver.
+        Teuchos::RCP<Thyra::LinearOpWithSolveBase<Scalar>> thyra_C_lows =
+            factory->createOp();
+        Thyra::initializePreconditionedOp<Scalar>(
+            *factory, thyra_C, Thyra::unspecifiedPrec<Scalar>( thyra_J ),
+            thyra_C_lows.ptr() );
+        thyra_C_inv = Thyra::inverse<Scalar>( thyra_C_lows.getConst() );
+    }
+    else
+    {
+        thyra_C_inv = Thyra::inverse<Scalar>( *factory, thyra_C );
+    }
 
     // Create the composite operator B = (Q + N);
     Teuchos::RCP<const Thyra::LinearOpBase<Scalar>> thyra_B =
@@ -376,7 +524,8 @@ void SplineInterpolationOperator<Basis, DIM>::buildConcreteOperators(
     Teuchos::Array<double> dist_sources;
     CenterDistributor<DIM> source_distributor( comm, source_centers(),
                                                source_centers(),
-                                               source_proximity, dist_sources );
+                                               source_proximity, dist_sources,
+                                               d_use_cells );
 
     // Distribute the global source ids.
     Teuchos::Array<GO> dist_source_support_ids(
@@ -387,7 +536,8 @@ void SplineInterpolationOperator<Basis, DIM>::buildConcreteOperators(
 
     // Build the source/source pairings.
     SplineInterpolationPairing<DIM> source_pairings(
-        dist_sources(), source_centers(), d_use_knn, d_knn, d_radius );
+        dist_sources(), source_centers(), d_use_knn, d_knn, d_radius,
+        d_threaded );
 
     // Build the basis.
     Teuchos::RCP<Basis> basis = BP::create();
@@ -441,7 +591,8 @@ void SplineInterpolationOperator<Basis, DIM>::buildConcreteOperators(
     // centers on this proc.
     CenterDistributor<DIM> target_distributor( comm, source_centers(),
                                                target_centers(),
-                                               target_proximity, dist_sources );
+                                               target_proximity, dist_sources,
+                                               d_use_cells );
 
     // Distribute the global source ids.
     dist_source_support_ids.resize( target_distributor.getNumImports() );
@@ -451,7 +602,8 @@ void SplineInterpolationOperator<Basis, DIM>::buildConcreteOperators(
 
     // Build the source/target pairings.
     SplineInterpolationPairing<DIM> target_pairings(
-        dist_sources(), target_centers(), d_use_knn, d_knn, d_radius );
+        dist_sources(), target_centers(), d_use_knn, d_knn, d_radius,
+        d_threaded );
 
     // Build the transformation operators.
     SplineEvaluationMatrix<Basis, DIM> B(
@@ -467,6 +619,91 @@ void SplineInterpolationOperator<Basis, DIM>::buildConcreteOperators(
     DTK_ENSURE( Teuchos::nonnull( N ) );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the partition of unity interpolation operator.
+ */
+template <class Basis, int DIM>
+void SplineInterpolationOperator<Basis, DIM>::buildPartitionOfUnityOperator(
+    const Teuchos::RCP<FunctionSpace> &domain_space,
+    const Teuchos::RCP<FunctionSpace> &range_space,
+    Teuchos::RCP<const Root> &A ) const
+{
+    // Extract the Support maps.
+    const Teuchos::RCP<const typename Base::TpetraMap> domain_map =
+        this->getDomainMap();
+    const Teuchos::RCP<const typename Base::TpetraMap> range_map =
+        this->getRangeMap();
+
+    // Get the parallel communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = domain_map->getComm();
+
+    // Extract the source nodes and their ids.
+    Teuchos::ArrayRCP<double> source_centers;
+    Teuchos::ArrayRCP<GO> source_support_ids;
+    getNodeCoordsAndIds( domain_space, d_domain_entity_dim, source_centers,
+                         source_support_ids );
+
+    // Extract the target nodes and their ids.
+    Teuchos::ArrayRCP<double> target_centers;
+    Teuchos::ArrayRCP<GO> target_support_ids;
+    getNodeCoordsAndIds( range_space, d_range_entity_dim, target_centers,
+                         target_support_ids );
+
+    // Calculate an approximate neighborhood distance for the patches about
+    // the local target centers. If using kNN, compute an approximation. If
+    // doing a radial search, use the radius. The patch centers are within a
+    // patch radius of the targets so add it to the distance.
+    double target_proximity = 0.0;
+    if ( d_use_knn )
+    {
+        // Get the local bounding box.
+        Teuchos::Tuple<double, 6> local_box;
+        range_space->entitySet()->localBoundingBox( local_box );
+
+        // Calculate the largest span of the cardinal directions.
+        target_proximity = local_box[3] - local_box[0];
+        for ( int d = 1; d < DIM; ++d )
+        {
+            target_proximity =
+                std::max( target_proximity, local_box[d + 3] - local_box[d] );
+        }
+
+        // Take the proximity to be 10% of the largest distance.
+        target_proximity *= 0.1;
+    }
+    else
+    {
+        target_proximity = d_radius;
+    }
+    target_proximity += d_patch_radius;
+
+    // Gather the source centers that are in the proximity of the target
+    // centers on this proc. This is the only communication in the setup.
+    Teuchos::Array<double> dist_sources;
+    CenterDistributor<DIM> distributor( comm, source_centers(),
+                                        target_centers(), target_proximity,
+                                        dist_sources, d_use_cells );
+
+    // Distribute the global source ids.
+    Teuchos::Array<GO> dist_source_support_ids( distributor.getNumImports() );
+    Teuchos::ArrayView<const GO> source_support_ids_view = source_support_ids();
+    distributor.distribute( source_support_ids_view,
+                            dist_source_support_ids() );
+
+    // Build the basis.
+    Teuchos::RCP<Basis> basis = BP::create();
+
+    // Build the interpolation matrix from the local patch problems.
+    SplinePartitionOfUnityMatrix<Basis, DIM> pou(
+        domain_map, range_map, target_centers(), target_support_ids(),
+        dist_sources(), dist_source_support_ids(), d_use_knn, d_knn, d_radius,
+        d_patch_radius, d_threaded, *basis );
+    A = pou.getA();
+
+    DTK_ENSURE( Teuchos::nonnull( A ) );
+}
+
 //---------------------------------------------------------------------------//
 // Extract node coordinates and ids from an iterator.
 template <class Basis, int DIM>
@@ -481,9 +718,8 @@ void SplineInterpolationOperator<Basis, DIM>::getNodeCoordsAndIds(
     {
         LocalEntityPredicate local_predicate(
             space->entitySet()->communicator()->getRank() );
-        PredicateFunction predicate = PredicateComposition::And(
-            space->selectFunction(), local_predicate.getFunction() );
-        iterator = space->entitySet()->entityIterator( entity_dim, predicate );
+        iterator = space->selectedEntityIterator(
+            entity_dim, local_predicate.getFunction() );
     }
 
     // Extract the coordinates and support ids of the nodes.
@@ -41,7 +41,10 @@
 #ifndef DTK_INTERPOLATIONPAIRING_HPP
 #define DTK_INTERPOLATIONPAIRING_HPP
 
+#include <cstddef>
+
 #include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayRCP.hpp>
 #include <Teuchos_ArrayView.hpp>
 
 #include <DTK_Types.hpp>
@@ -56,6 +59,10 @@ namespace DataTransferKit
  * Build groups of local child centers that are within the given radius or the
  * k-nearest-neighbor set of the parent centers. Each parent center will have
  * a list of child centers.
+ *
+ * The pairings are stored in compressed row form: the child ids of parent i
+ * are found in [offsets[i], offsets[i+1]) of a single child id array. The
+ * search over the parents is threaded when requested and OpenMP is enabled.
  */
 //---------------------------------------------------------------------------//
 template <int DIM>
@@ -66,7 +73,8 @@ class SplineInterpolationPairing
     SplineInterpolationPairing(
         const Teuchos::ArrayView<const double> &child_centers,
         const Teuchos::ArrayView<const double> &parent_centers,
-        const bool use_knn, const unsigned num_neighbors, const double radius );
+        const bool use_knn, const unsigned num_neighbors, const double radius,
+        const bool threaded );
 
     // Given a parent center local id get the ids of the child centers within
     // the given radius.
@@ -79,12 +87,22 @@ class SplineInterpolationPairing
         return d_pair_sizes;
     }
 
+    // Get the offsets of each parent into the child id array. Raw pointers
+    // are provided for use in threaded loops.
+    const std::size_t *childOffsets() const { return d_offsets.getRawPtr(); }
+
+    // Get the child ids of all parents.
+    const unsigned *childIds() const { return d_children.getRawPtr(); }
+
     // Get the support radius of a given parent.
     double parentSupportRadius( const unsigned parent_id ) const;
 
   private:
-    // Pairings.
-    Teuchos::Array<Teuchos::Array<unsigned>> d_pairings;
+    // Offsets into the child id array for each parent.
+    Teuchos::Array<std::size_t> d_offsets;
+
+    // Child ids of all parents.
+    Teuchos::Array<unsigned> d_children;
 
     // Number of child centers per parent center.
     Teuchos::ArrayRCP<EntityId> d_pair_sizes;
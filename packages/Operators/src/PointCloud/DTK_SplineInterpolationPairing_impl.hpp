@@ -41,11 +41,14 @@
 #ifndef DTK_SPLINEINTERPOLATIONPAIRING_IMPL_HPP
 #define DTK_SPLINEINTERPOLATIONPAIRING_IMPL_HPP
 
+#include <cmath>
+
 #include "DTK_DBC.hpp"
-#include "DTK_EuclideanDistance.hpp"
 #include "DTK_SplineInterpolationPairing.hpp"
 #include "DTK_StaticSearchTree.hpp"
 
+#include <Teuchos_TimeMonitor.hpp>
+
 namespace DataTransferKit
 {
 //---------------------------------------------------------------------------//
@@ -56,8 +59,12 @@ template <int DIM>
 SplineInterpolationPairing<DIM>::SplineInterpolationPairing(
     const Teuchos::ArrayView<const double> &child_centers,
     const Teuchos::ArrayView<const double> &parent_centers, const bool use_knn,
-    const unsigned num_neighbors, const double radius )
+    const unsigned num_neighbors, const double radius, const bool threaded )
 {
+    auto timer =
+        Teuchos::TimeMonitor::getNewCounter( "DTK: Coarse Local Search" );
+    Teuchos::TimeMonitor monitor( *timer );
+
     DTK_REQUIRE( 0 == child_centers.size() % DIM );
     DTK_REQUIRE( 0 == parent_centers.size() % DIM );
 
@@ -65,45 +72,52 @@ SplineInterpolationPairing<DIM>::SplineInterpolationPairing(
     unsigned leaf_size = 30;
     NanoflannTree<DIM> tree( child_centers, leaf_size );
 
-    // Allocate arrays
+    // Search for the children of all the parents at once. The queries are
+    // split over the available threads if requested and written directly
+    // into the CSR storage.
+    Teuchos::Array<double> squared_distances;
+    if ( use_knn )
+    {
+        tree.nnSearch( parent_centers, num_neighbors, threaded, d_offsets,
+                       d_children, squared_distances );
+    }
+    else
+    {
+        tree.radiusSearch( parent_centers, radius, threaded, d_offsets,
+                           d_children, squared_distances );
+    }
+
+    // Compute the support sizes and radii.
     unsigned num_parents = parent_centers.size() / DIM;
-    d_pairings.resize( num_parents );
     d_pair_sizes = Teuchos::ArrayRCP<EntityId>( num_parents );
     d_radii.resize( num_parents );
-
-    // Search for pairs
     for ( unsigned i = 0; i < num_parents; ++i )
     {
-        // If kNN do the nearest neighbor search for kNN and calculate a
-        // radius. The radius will be a small fraction larger than the
-        // farthest neighbor. An alternative to this would be to find the
+        d_pair_sizes[i] = d_offsets[i + 1] - d_offsets[i];
+
+        // If kNN calculate a radius from the farthest neighbor. Make it
+        // slightly larger so the last neighbor gives a non-zero contribution
+        // to the interpolant. An alternative to this would be to find the
         // kNN+1 neighbors and use the last neighbor's distance as the
         // radius.
-        if ( use_knn )
+        if ( !use_knn )
         {
-            // Get the knn neighbors
-            d_pairings[i] =
-                tree.nnSearch( parent_centers( DIM * i, DIM ), num_neighbors );
-
-            // Get the radius from kNN. Make it slightly larger so the last
-            // neighbor gives a non-zero contribution to the interpolant.
-            d_radii[i] = EuclideanDistance<DIM>::distance(
-                parent_centers( DIM * i, DIM ).getRawPtr(),
-                child_centers( DIM * d_pairings[i].back(), DIM ).getRawPtr() );
-            d_radii[i] *= 1.01;
+            d_radii[i] = radius;
+        }
+        else if ( d_pair_sizes[i] > 0 )
+        {
+            d_radii[i] =
+                1.01 * std::sqrt( squared_distances[d_offsets[i + 1] - 1] );
         }
-
-        // Otherwise do the radius search.
         else
         {
-            d_pairings[i] =
-                tree.radiusSearch( parent_centers( DIM * i, DIM ), radius );
-            d_radii[i] = radius;
+            d_radii[i] = 0.0;
         }
-
-        // Get the size of the support.
-        d_pair_sizes[i] = d_pairings[i].size();
     }
+
+    DTK_ENSURE( d_offsets.size() == num_parents + 1 );
+    DTK_ENSURE( d_offsets.back() == Teuchos::as<std::size_t>(
+                                        d_children.size() ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -116,9 +130,9 @@ Teuchos::ArrayView<const unsigned>
 SplineInterpolationPairing<DIM>::childCenterIds(
     const unsigned parent_id ) const
 {
-    DTK_REQUIRE( parent_id < d_pairings.size() );
-    Teuchos::ArrayView<const unsigned> id_view = d_pairings[parent_id]();
-    return id_view;
+    DTK_REQUIRE( parent_id < d_radii.size() );
+    return d_children.view( d_offsets[parent_id],
+                            d_offsets[parent_id + 1] - d_offsets[parent_id] );
 }
 
 //---------------------------------------------------------------------------//
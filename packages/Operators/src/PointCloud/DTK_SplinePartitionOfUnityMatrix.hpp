@@ -0,0 +1,120 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   DTK_SplinePartitionOfUnityMatrix.hpp
+ * \author Stuart R. Slattery
+ * \brief  Partition of unity spline interpolation matrix.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_SPLINEPARTITIONOFUNITYMATRIX_HPP
+#define DTK_SPLINEPARTITIONOFUNITYMATRIX_HPP
+
+#include "DTK_RadialBasisPolicy.hpp"
+
+#include <DTK_Types.hpp>
+
+#include <Teuchos_ArrayView.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Map.hpp>
+#include <Tpetra_Operator.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \class SplinePartitionOfUnityMatrix
+ * \brief Sparse interpolation matrix built from local spline problems
+ * blended with partition of unity weights.
+ *
+ * Patches are centered on the nodes of a regular lattice with spacing
+ * patch_radius / sqrt(DIM), so every target is within half a patch radius of
+ * a patch center. Each patch solves a small spline problem, with a linear
+ * polynomial, over the source centers found about its center by the given
+ * search. The patch interpolants are blended at the targets with normalized
+ * Wendland weights of support patch_radius. A kNN search must find at least
+ * DIM + 1 neighbors. Patches with too few sources for the polynomial are
+ * skipped. A target covered only by skipped patches takes the interpolant of
+ * the nearest patch that was solved.
+ *
+ * The matrix maps source values directly to target values so no global
+ * solve is needed. All patch problems are local to the process that owns the
+ * targets. If threaded is set and DTK is built with OpenMP the searches and
+ * patch problems are split over the threads.
+ */
+//---------------------------------------------------------------------------//
+template <class Basis, int DIM>
+class SplinePartitionOfUnityMatrix
+{
+  public:
+    //@{
+    //! Typedefs.
+    typedef RadialBasisPolicy<Basis> BP;
+    //@}
+
+    // Constructor.
+    SplinePartitionOfUnityMatrix(
+        const Teuchos::RCP<const Tpetra::Map<int, SupportId>> &domain_map,
+        const Teuchos::RCP<const Tpetra::Map<int, SupportId>> &range_map,
+        const Teuchos::ArrayView<const double> &target_centers,
+        const Teuchos::ArrayView<const SupportId> &target_center_gids,
+        const Teuchos::ArrayView<const double> &dist_source_centers,
+        const Teuchos::ArrayView<const SupportId> &dist_source_center_gids,
+        const bool use_knn, const unsigned num_neighbors, const double radius,
+        const double patch_radius, const bool threaded, const Basis &basis );
+
+    // Get the interpolation matrix.
+    Teuchos::RCP<Tpetra::Operator<double, int, SupportId>> getA()
+    {
+        return d_A;
+    }
+
+  private:
+    // The interpolation matrix.
+    Teuchos::RCP<Tpetra::CrsMatrix<double, int, SupportId>> d_A;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_SPLINEPARTITIONOFUNITYMATRIX_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_SplinePartitionOfUnityMatrix.hpp
+//---------------------------------------------------------------------------//
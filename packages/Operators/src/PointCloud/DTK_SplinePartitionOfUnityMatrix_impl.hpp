@@ -0,0 +1,458 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   DTK_SplinePartitionOfUnityMatrix_impl.hpp
+ * \author Stuart R. Slattery
+ * \brief  Partition of unity spline interpolation matrix.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_SPLINEPARTITIONOFUNITYMATRIX_IMPL_HPP
+#define DTK_SPLINEPARTITIONOFUNITYMATRIX_IMPL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <set>
+
+#include "DTK_DBC.hpp"
+#include "DTK_EuclideanDistance.hpp"
+#include "DTK_SplineInterpolationPairing.hpp"
+#include "DTK_SplinePartitionOfUnityMatrix.hpp"
+#include "DTK_ThreadedBlocks.hpp"
+#include "DTK_WendlandBasis.hpp"
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_LAPACK.hpp>
+#include <Teuchos_OrdinalTraits.hpp>
+#include <Teuchos_TimeMonitor.hpp>
+#include <Teuchos_as.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ */
+template <class Basis, int DIM>
+SplinePartitionOfUnityMatrix<Basis, DIM>::SplinePartitionOfUnityMatrix(
+    const Teuchos::RCP<const Tpetra::Map<int, SupportId>> &domain_map,
+    const Teuchos::RCP<const Tpetra::Map<int, SupportId>> &range_map,
+    const Teuchos::ArrayView<const double> &target_centers,
+    const Teuchos::ArrayView<const SupportId> &target_center_gids,
+    const Teuchos::ArrayView<const double> &dist_source_centers,
+    const Teuchos::ArrayView<const SupportId> &dist_source_center_gids,
+    const bool use_knn, const unsigned num_neighbors, const double radius,
+    const double patch_radius, const bool threaded, const Basis &basis )
+{
+    DTK_REQUIRE( 0 == target_centers.size() % DIM );
+    DTK_REQUIRE( target_centers.size() / DIM == target_center_gids.size() );
+    DTK_REQUIRE( 0 == dist_source_centers.size() % DIM );
+    DTK_REQUIRE( dist_source_centers.size() / DIM ==
+                 dist_source_center_gids.size() );
+    DTK_REQUIRE( 0.0 < patch_radius );
+    DTK_REQUIRE( !use_knn || Teuchos::as<int>( num_neighbors ) >= DIM + 1 );
+
+    // Place a patch on every corner of the lattice cells holding a target.
+    // The nearest corner is then within half a patch radius of the target.
+    int num_targets = target_center_gids.size();
+    double spacing = patch_radius / std::sqrt( Teuchos::as<double>( DIM ) );
+    std::set<std::array<long long, DIM>> patch_nodes;
+    std::array<long long, DIM> cell;
+    std::array<long long, DIM> node;
+    for ( int t = 0; t < num_targets; ++t )
+    {
+        for ( int d = 0; d < DIM; ++d )
+        {
+            cell[d] = Teuchos::as<long long>(
+                std::floor( target_centers[DIM * t + d] / spacing ) );
+        }
+        for ( int c = 0; c < ( 1 << DIM ); ++c )
+        {
+            for ( int d = 0; d < DIM; ++d )
+            {
+                node[d] = cell[d] + ( ( c >> d ) & 1 );
+            }
+            patch_nodes.insert( node );
+        }
+    }
+    int num_patches = patch_nodes.size();
+    Teuchos::Array<double> patch_centers( DIM * num_patches );
+    int p = 0;
+    for ( auto &n : patch_nodes )
+    {
+        for ( int d = 0; d < DIM; ++d )
+        {
+            patch_centers[DIM * p + d] = spacing * n[d];
+        }
+        ++p;
+    }
+
+    // Find the sources that build each patch problem and the targets that
+    // each patch contributes to.
+    SplineInterpolationPairing<DIM> patch_sources(
+        dist_source_centers, patch_centers(), use_knn, num_neighbors, radius,
+        threaded );
+    SplineInterpolationPairing<DIM> patch_targets(
+        target_centers, patch_centers(), false, 0, patch_radius, threaded );
+
+    auto timer = Teuchos::TimeMonitor::getNewCounter( "DTK: Matrix Fill" );
+    Teuchos::TimeMonitor monitor( *timer );
+
+    // A patch needs enough sources for the linear polynomial.
+    int poly_size = DIM + 1;
+    Teuchos::ArrayRCP<EntityId> sources_per_patch =
+        patch_sources.childrenPerParent();
+    Teuchos::ArrayRCP<EntityId> targets_per_patch =
+        patch_targets.childrenPerParent();
+
+    // Compute the partition of unity weight normalization at the targets.
+    WendlandBasis<2> weight_basis;
+    Teuchos::Array<double> weight_sums( num_targets, 0.0 );
+    Teuchos::ArrayView<const unsigned> targets;
+    for ( p = 0; p < num_patches; ++p )
+    {
+        if ( Teuchos::as<int>( sources_per_patch[p] ) >= poly_size )
+        {
+            targets = patch_targets.childCenterIds( p );
+            for ( auto t : targets )
+            {
+                weight_sums[t] += weight_basis.evaluateValue(
+                    patch_radius,
+                    EuclideanDistance<DIM>::distance(
+                        &patch_centers[DIM * p], &target_centers[DIM * t] ) );
+            }
+        }
+    }
+
+    // A target only covered by skipped patches would get an empty row.
+    // Instead it takes the full interpolant of the nearest solved patch. If
+    // no patch can be solved on this process the rows stay empty.
+    Teuchos::Array<int> solved_patches;
+    Teuchos::Array<double> solved_centers;
+    for ( p = 0; p < num_patches; ++p )
+    {
+        if ( Teuchos::as<int>( sources_per_patch[p] ) >= poly_size )
+        {
+            solved_patches.push_back( p );
+            solved_centers.insert( solved_centers.end(),
+                                   &patch_centers[DIM * p],
+                                   &patch_centers[DIM * p] + DIM );
+        }
+    }
+    Teuchos::Array<int> uncovered_targets;
+    Teuchos::Array<double> uncovered_centers;
+    for ( int t = 0; t < num_targets; ++t )
+    {
+        if ( !( 0.0 < weight_sums[t] ) )
+        {
+            uncovered_targets.push_back( t );
+            uncovered_centers.insert( uncovered_centers.end(),
+                                      &target_centers[DIM * t],
+                                      &target_centers[DIM * t] + DIM );
+        }
+    }
+    Teuchos::Array<int> fallback_offsets( num_patches + 1, 0 );
+    Teuchos::Array<int> fallback_targets;
+    if ( !uncovered_targets.empty() && !solved_patches.empty() )
+    {
+        SplineInterpolationPairing<DIM> nearest_patch(
+            solved_centers(), uncovered_centers(), true, 1, 0.0, threaded );
+        int num_uncovered = uncovered_targets.size();
+        Teuchos::Array<int> target_patch( num_uncovered );
+        for ( int i = 0; i < num_uncovered; ++i )
+        {
+            target_patch[i] =
+                solved_patches[nearest_patch.childCenterIds( i )[0]];
+            ++fallback_offsets[target_patch[i] + 1];
+        }
+        for ( p = 0; p < num_patches; ++p )
+        {
+            fallback_offsets[p + 1] += fallback_offsets[p];
+        }
+        fallback_targets.resize( num_uncovered );
+        Teuchos::Array<int> fallback_count( fallback_offsets.begin(),
+                                            fallback_offsets.end() - 1 );
+        for ( int i = 0; i < num_uncovered; ++i )
+        {
+            fallback_targets[fallback_count[target_patch[i]]++] =
+                uncovered_targets[i];
+        }
+    }
+
+    // Solve the patch problems. Patches are split into contiguous blocks and
+    // each block keeps its own entries. If requested and DTK is built with
+    // OpenMP the blocks are solved concurrently. The blocks only read the
+    // pairings through raw pointers so no reference counts are changed from
+    // the threads.
+    const std::size_t *source_offsets = patch_sources.childOffsets();
+    const unsigned *source_ids = patch_sources.childIds();
+    const std::size_t *target_offsets = patch_targets.childOffsets();
+    const unsigned *target_ids = patch_targets.childIds();
+    const int *fallback_ids = fallback_targets.getRawPtr();
+    const int min_block_size = 64;
+    int num_blocks = numThreadBlocks( num_patches, min_block_size, threaded );
+    Teuchos::Array<Teuchos::Array<int>> block_rows( num_blocks );
+    Teuchos::Array<Teuchos::Array<unsigned>> block_columns( num_blocks );
+    Teuchos::Array<Teuchos::Array<double>> block_values( num_blocks );
+    forEachBlock(
+        num_patches, num_blocks,
+        [&]( const int b, const int block_begin, const int block_end ) {
+            // Size the workspace once for the largest patch in the block.
+            // The LAPACK workspace requirements grow with the problem size
+            // so the largest query covers every patch.
+            Teuchos::LAPACK<int, double> lapack;
+            int max_nk = 0;
+            int max_nt = 0;
+            for ( int q = block_begin; q < block_end; ++q )
+            {
+                int ns = Teuchos::as<int>( sources_per_patch[q] );
+                if ( ns >= poly_size )
+                {
+                    max_nk = std::max( max_nk, ns + poly_size );
+                    max_nt = std::max(
+                        max_nt, Teuchos::as<int>( targets_per_patch[q] ) +
+                                    fallback_offsets[q + 1] -
+                                    fallback_offsets[q] );
+                }
+            }
+            if ( 0 == max_nt )
+            {
+                return;
+            }
+            Teuchos::Array<double> packed_sources;
+            Teuchos::Array<double> K( max_nk * max_nk );
+            Teuchos::Array<double> G( max_nk * max_nt );
+            Teuchos::Array<double> s( max_nk );
+            double rcond = std::numeric_limits<double>::epsilon();
+            double work_size = 0.0;
+            int rank = 0;
+            int info = 0;
+            lapack.GELSS( max_nk, max_nk, max_nt, K.getRawPtr(), max_nk,
+                          G.getRawPtr(), max_nk, s.getRawPtr(), rcond, &rank,
+                          &work_size, -1, &info );
+            DTK_CHECK( 0 == info );
+            Teuchos::Array<double> work( Teuchos::as<int>( work_size ) );
+
+            for ( int q = block_begin; q < block_end; ++q )
+            {
+                const unsigned *sources = source_ids + source_offsets[q];
+                const unsigned *patch_target_ids =
+                    target_ids + target_offsets[q];
+                const int *patch_fallback_ids =
+                    fallback_ids + fallback_offsets[q];
+                int ns = source_offsets[q + 1] - source_offsets[q];
+                int nc = target_offsets[q + 1] - target_offsets[q];
+                int nt = nc + fallback_offsets[q + 1] - fallback_offsets[q];
+                if ( ns < poly_size || 0 == nt )
+                {
+                    continue;
+                }
+                double support = patch_sources.parentSupportRadius( q );
+                int nk = ns + poly_size;
+
+                // The patch targets are the covered targets followed by the
+                // fallback targets.
+                auto target_id = [&]( const int i ) {
+                    return ( i < nc ) ? Teuchos::as<int>( patch_target_ids[i] )
+                                      : patch_fallback_ids[i - nc];
+                };
+
+                // Build the local spline matrix
+                // K = [ M P ; P^T 0 ].
+                packed_sources.resize( DIM * ns );
+                packRadialBasisNeighbors<DIM>(
+                    dist_source_centers.getRawPtr(), sources, ns,
+                    packed_sources.getRawPtr() );
+                std::fill( K.getRawPtr(), K.getRawPtr() + nk * nk, 0.0 );
+                for ( int j = 0; j < ns; ++j )
+                {
+                    const double *source =
+                        &dist_source_centers[DIM * sources[j]];
+                    BP::template evaluateValues<DIM>(
+                        basis, support, source, packed_sources.getRawPtr(),
+                        ns, &K[nk * j] );
+                    K[ns + nk * j] = 1.0;
+                    K[j + nk * ns] = 1.0;
+                    for ( int d = 0; d < DIM; ++d )
+                    {
+                        K[ns + d + 1 + nk * j] = source[d];
+                        K[j + nk * ( ns + d + 1 )] = source[d];
+                    }
+                }
+
+                // Build the evaluation vectors of the targets as the right
+                // hand sides.
+                std::fill( G.getRawPtr(), G.getRawPtr() + nk * nt, 0.0 );
+                for ( int i = 0; i < nt; ++i )
+                {
+                    const double *target =
+                        &target_centers[DIM * target_id( i )];
+                    BP::template evaluateValues<DIM>(
+                        basis, support, target, packed_sources.getRawPtr(),
+                        ns, &G[nk * i] );
+                    G[ns + nk * i] = 1.0;
+                    for ( int d = 0; d < DIM; ++d )
+                    {
+                        G[ns + d + 1 + nk * i] = target[d];
+                    }
+                }
+
+                // K is symmetric so K^-1 G holds the transposed rows of the
+                // patch interpolant evaluated at the targets.
+                lapack.GELSS( nk, nk, nt, K.getRawPtr(), nk, G.getRawPtr(),
+                              nk, s.getRawPtr(), rcond, &rank,
+                              work.getRawPtr(), work.size(), &info );
+                DTK_CHECK( 0 == info );
+
+                // Blend the patch interpolant into the target rows. Covered
+                // targets are weighted with the normalized partition of
+                // unity weights and fallback targets take the full
+                // interpolant.
+                for ( int i = 0; i < nt; ++i )
+                {
+                    int t = target_id( i );
+                    double weight = 1.0;
+                    if ( i < nc )
+                    {
+                        if ( !( 0.0 < weight_sums[t] ) )
+                        {
+                            continue;
+                        }
+                        weight = weight_basis.evaluateValue(
+                                     patch_radius,
+                                     EuclideanDistance<DIM>::distance(
+                                         &patch_centers[DIM * q],
+                                         &target_centers[DIM * t] ) ) /
+                                 weight_sums[t];
+                    }
+                    for ( int j = 0; j < ns; ++j )
+                    {
+                        block_rows[b].push_back( t );
+                        block_columns[b].push_back( sources[j] );
+                        block_values[b].push_back( weight * G[j + nk * i] );
+                    }
+                }
+            }
+        } );
+
+    // Gather the entries by row and column and sum the contributions of
+    // overlapping patches.
+    Teuchos::Array<int> rows;
+    Teuchos::Array<SupportId> columns;
+    Teuchos::Array<double> values;
+    for ( int b = 0; b < num_blocks; ++b )
+    {
+        for ( int n = 0; n < block_rows[b].size(); ++n )
+        {
+            rows.push_back( block_rows[b][n] );
+            columns.push_back( dist_source_center_gids[block_columns[b][n]] );
+            values.push_back( block_values[b][n] );
+        }
+        block_rows[b].clear();
+        block_columns[b].clear();
+        block_values[b].clear();
+    }
+    int num_entries = rows.size();
+    Teuchos::Array<int> entry_order( num_entries );
+    for ( int n = 0; n < num_entries; ++n )
+    {
+        entry_order[n] = n;
+    }
+    std::sort( entry_order.begin(), entry_order.end(),
+               [&rows, &columns]( const int a, const int b ) {
+                   return ( rows[a] != rows[b] ) ? rows[a] < rows[b]
+                                                 : columns[a] < columns[b];
+               } );
+    int num_rows = range_map->getNodeNumElements();
+    Teuchos::ArrayRCP<std::size_t> row_sizes( num_rows, 0 );
+    Teuchos::Array<int> target_rows( num_targets );
+    for ( int t = 0; t < num_targets; ++t )
+    {
+        target_rows[t] = range_map->getLocalElement( target_center_gids[t] );
+        DTK_CHECK( Teuchos::OrdinalTraits<int>::invalid() != target_rows[t] );
+    }
+    Teuchos::Array<int> entry_rows;
+    Teuchos::Array<SupportId> entry_columns;
+    Teuchos::Array<double> entry_values;
+    for ( int n = 0; n < num_entries; ++n )
+    {
+        int e = entry_order[n];
+        if ( n > 0 && rows[e] == entry_rows.back() &&
+             columns[e] == entry_columns.back() )
+        {
+            entry_values.back() += values[e];
+        }
+        else
+        {
+            entry_rows.push_back( rows[e] );
+            entry_columns.push_back( columns[e] );
+            entry_values.push_back( values[e] );
+            ++row_sizes[target_rows[rows[e]]];
+        }
+    }
+
+    // Build the matrix with static profile from the exact row sizes.
+    d_A = Teuchos::rcp( new Tpetra::CrsMatrix<double, int, SupportId>(
+        range_map, row_sizes.getConst(), Tpetra::StaticProfile ) );
+    int row_begin = 0;
+    int num_merged = entry_rows.size();
+    for ( int n = 1; n <= num_merged; ++n )
+    {
+        if ( n == num_merged || entry_rows[n] != entry_rows[row_begin] )
+        {
+            d_A->insertGlobalValues(
+                target_center_gids[entry_rows[row_begin]],
+                entry_columns( row_begin, n - row_begin ),
+                entry_values( row_begin, n - row_begin ) );
+            row_begin = n;
+        }
+    }
+    d_A->fillComplete( domain_map, range_map );
+
+    DTK_ENSURE( d_A->isFillComplete() );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_SPLINEPARTITIONOFUNITYMATRIX_IMPL_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_SplinePartitionOfUnityMatrix_impl.hpp
+//---------------------------------------------------------------------------//
@@ -90,6 +90,17 @@ class RadialBasisPolicy<WendlandBasis<ORDER>>
     {
         return basis.evaluateGradient( radius, x );
     }
+
+    template <int DIM>
+    static inline void evaluateValues( const WendlandBasis<ORDER> &basis,
+                                       const double radius,
+                                       const double *center,
+                                       const double *neighbors,
+                                       const int num_neighbors, double *values )
+    {
+        evaluateRadialBasisValues<DIM>( basis, radius, center, neighbors,
+                                        num_neighbors, values );
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -38,11 +38,15 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
+#include <string>
 
 #include "DTK_CoarseGlobalSearch.hpp"
 
 #include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_TimeMonitor.hpp>
 
 #include <Tpetra_Distributor.hpp>
 
@@ -54,8 +58,21 @@ CoarseGlobalSearch::CoarseGlobalSearch(
     const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
     const int physical_dimension, const EntityIterator &domain_iterator,
     const Teuchos::ParameterList &parameters )
+    : CoarseGlobalSearch( comm, physical_dimension,
+                          EntityBoundingBoxCache( domain_iterator ),
+                          parameters )
+{ /* ... */
+}
+
+//---------------------------------------------------------------------------//
+// Constructor with the domain entity bounding boxes already computed.
+CoarseGlobalSearch::CoarseGlobalSearch(
+    const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+    const int physical_dimension, const EntityBoundingBoxCache &domain_boxes,
+    const Teuchos::ParameterList &parameters )
     : d_comm( comm )
     , d_space_dim( physical_dimension )
+    , d_num_sub_boxes( 1 )
     , d_track_missed_range_entities( false )
     , d_missed_range_entity_ids( 0 )
     , d_inclusion_tol( 1.0e-6 )
@@ -73,26 +90,86 @@ CoarseGlobalSearch::CoarseGlobalSearch(
         d_inclusion_tol = parameters.get<double>( "Point Inclusion Tolerance" );
     }
 
-    // Assemble the local domain bounding box.
-    Teuchos::Tuple<double, 6> domain_box;
-    assembleBoundingBox( domain_iterator, domain_box );
+    // Get the number of sub-boxes each process publishes.
+    if ( parameters.isParameter( "Coarse Global Search Sub-Boxes" ) )
+    {
+        d_num_sub_boxes =
+            parameters.get<int>( "Coarse Global Search Sub-Boxes" );
+    }
+    DTK_REQUIRE( d_num_sub_boxes > 0 );
+
+    // Determine the type of search.
+    bool use_tree = false;
+    if ( parameters.isParameter( "Coarse Global Search Type" ) )
+    {
+        if ( "Brute Force" ==
+             parameters.get<std::string>( "Coarse Global Search Type" ) )
+        {
+            use_tree = false;
+        }
+        else if ( "Bounding Volume Hierarchy" ==
+                  parameters.get<std::string>( "Coarse Global Search Type" ) )
+        {
+            use_tree = true;
+        }
+        else
+        {
+            // Otherwise we got an invalid search type.
+            DTK_INSIST( false );
+        }
+    }
+
+    // Assemble the local domain bounding boxes.
+    Teuchos::Array<Teuchos::Tuple<double, 6>> sub_boxes;
+    assembleSubBoxes( domain_boxes, sub_boxes );
+    Teuchos::Array<double> local_bounds( 6 * d_num_sub_boxes );
+    for ( int n = 0; n < d_num_sub_boxes; ++n )
+    {
+        std::copy( sub_boxes[n].begin(), sub_boxes[n].end(),
+                   local_bounds.begin() + 6 * n );
+    }
 
     // Gather the bounding boxes from all domains.
     int comm_size = d_comm->getSize();
-    Teuchos::Array<double> all_bounds( 6 * comm_size );
-    Teuchos::gatherAll<int, double>( *d_comm, 6, domain_box.getRawPtr(),
+    Teuchos::Array<double> all_bounds( 6 * d_num_sub_boxes * comm_size );
+    Teuchos::gatherAll<int, double>( *d_comm, local_bounds.size(),
+                                     local_bounds.getRawPtr(),
                                      all_bounds.size(),
                                      all_bounds.getRawPtr() );
 
-    // Extract the bounding boxes.
-    d_domain_boxes.resize( comm_size );
+    // Extract the bounding boxes. Processes with fewer entities than
+    // sub-boxes publish empty boxes which are skipped.
+    int num_boxes = d_num_sub_boxes * comm_size;
     int id = 0;
-    for ( int n = 0; n < comm_size; ++n )
+    for ( int n = 0; n < num_boxes; ++n )
     {
         id = 6 * n;
-        d_domain_boxes[n] = Teuchos::tuple(
-            all_bounds[id], all_bounds[id + 1], all_bounds[id + 2],
-            all_bounds[id + 3], all_bounds[id + 4], all_bounds[id + 5] );
+        if ( all_bounds[id] <= all_bounds[id + 3] )
+        {
+            d_domain_boxes.push_back( Teuchos::tuple(
+                all_bounds[id], all_bounds[id + 1], all_bounds[id + 2],
+                all_bounds[id + 3], all_bounds[id + 4], all_bounds[id + 5] ) );
+            d_domain_box_ranks.push_back( n / d_num_sub_boxes );
+        }
+    }
+
+    // Build a bounding volume hierarchy over the domain boxes grown by the
+    // inclusion tolerance.
+    if ( use_tree )
+    {
+        num_boxes = d_domain_boxes.size();
+        Teuchos::Array<double> tree_boxes( 6 * num_boxes );
+        Teuchos::Tuple<double, 6> grown_box;
+        for ( int n = 0; n < num_boxes; ++n )
+        {
+            grown_box = growBox( d_domain_boxes[n] );
+            std::copy( grown_box.begin(), grown_box.end(),
+                       tree_boxes.begin() + 6 * n );
+        }
+        int leaf_size = std::max( 1, std::min( 4, num_boxes ) );
+        d_box_tree = Teuchos::rcp(
+            new BoundingVolumeHierarchy( tree_boxes(), leaf_size ) );
+        DTK_ENSURE( Teuchos::nonnull( d_box_tree ) );
     }
 }
 
@@ -107,84 +184,108 @@ void CoarseGlobalSearch::search(
     Teuchos::Array<int> &range_owner_ranks,
     Teuchos::Array<double> &range_centroids ) const
 {
+    auto timer =
+        Teuchos::TimeMonitor::getNewCounter( "DTK: Coarse Global Search" );
+    Teuchos::TimeMonitor monitor( *timer );
+
     // Assemble the local range bounding box.
     Teuchos::Tuple<double, 6> range_box;
     assembleBoundingBox( range_iterator, range_box );
 
-    // Find the domain boxes it intersects with.
-    Teuchos::Array<int> neighbor_ranks;
-    Teuchos::Array<Teuchos::Tuple<double, 6>> neighbor_boxes;
-    int num_domains = d_domain_boxes.size();
-    for ( int n = 0; n < num_domains; ++n )
+    // If we are not using the tree, find the domain boxes it intersects
+    // with.
+    Teuchos::Array<int> neighbor_boxes;
+    if ( Teuchos::is_null( d_box_tree ) )
     {
-        if ( boxesIntersect( range_box, d_domain_boxes[n], d_inclusion_tol ) )
+        int num_domains = d_domain_boxes.size();
+        for ( int n = 0; n < num_domains; ++n )
         {
-            neighbor_ranks.push_back( n );
-            neighbor_boxes.push_back( d_domain_boxes[n] );
+            if ( boxesIntersect( range_box, d_domain_boxes[n],
+                                 d_inclusion_tol ) )
+            {
+                neighbor_boxes.push_back( n );
+            }
         }
     }
 
     // For each local range entity, find the neighbors we should send it to.
-    int num_neighbors = neighbor_boxes.size();
     EntityIterator range_begin = range_iterator.begin();
     EntityIterator range_end = range_iterator.end();
     EntityIterator range_it;
-    Teuchos::Array<EntityId> send_ids;
     Teuchos::Array<int> send_ranks;
-    Teuchos::Array<double> send_centroids;
+    Teuchos::Array<EntityId> send_data;
     Teuchos::Array<double> centroid( d_space_dim );
-    bool found_entity = false;
+    Teuchos::Array<unsigned> centroid_boxes;
+    Teuchos::Array<int> centroid_ranks;
     for ( range_it = range_begin; range_it != range_end; ++range_it )
     {
         // Get the centroid.
         range_local_map->centroid( *range_it, centroid() );
 
-        // Check the neighbors.
-        found_entity = false;
-        for ( int n = 0; n < num_neighbors; ++n )
+        // Find the ranks of the domain boxes the centroid is in.
+        centroid_ranks.clear();
+        if ( Teuchos::nonnull( d_box_tree ) )
+        {
+            d_box_tree->pointSearch( centroid(), centroid_boxes );
+            for ( auto b : centroid_boxes )
+            {
+                centroid_ranks.push_back( d_domain_box_ranks[b] );
+            }
+        }
+        else
         {
-            // If the centroid is in the box, add it to the send list.
-            if ( pointInBox( centroid(), neighbor_boxes[n], d_inclusion_tol ) )
+            for ( auto b : neighbor_boxes )
             {
-                found_entity = true;
-                send_ids.push_back( range_it->id() );
-                send_ranks.push_back( neighbor_ranks[n] );
-                for ( int d = 0; d < d_space_dim; ++d )
+                if ( pointInBox( centroid(), d_domain_boxes[b],
+                                 d_inclusion_tol ) )
                 {
-                    send_centroids.push_back( centroid[d] );
+                    centroid_ranks.push_back( d_domain_box_ranks[b] );
                 }
             }
         }
 
+        // The centroid may be in several boxes from the same rank so only
+        // send it once to each rank.
+        auto centroid_ranks_end =
+            std::unique( centroid_ranks.begin(), centroid_ranks.end() );
+        centroid_ranks.resize(
+            std::distance( centroid_ranks.begin(), centroid_ranks_end ) );
+
+        // Add the entity id, owner rank, and centroid to the send list.
+        for ( auto rank : centroid_ranks )
+        {
+            send_ranks.push_back( rank );
+            packRangeEntity( range_it->id(), d_comm->getRank(), centroid(),
+                             send_data );
+        }
+
         // If we are tracking missed range entities, add the entity to the
         // list.
-        if ( d_track_missed_range_entities && !found_entity )
+        if ( d_track_missed_range_entities && centroid_ranks.empty() )
         {
             d_missed_range_entity_ids.push_back( range_it->id() );
         }
     }
-    int num_send = send_ranks.size();
-    Teuchos::Array<int> range_ranks( num_send, d_comm->getRank() );
 
-    // Create a distributor.
+    // Redistribute the range entities. The ids, owner ranks, and centroids
+    // are packed together so only one message is sent to each process.
     Tpetra::Distributor distributor( d_comm );
     int num_range_import = distributor.createFromSends( send_ranks() );
+    int packet_size = 2 + d_space_dim;
+    Teuchos::Array<EntityId> import_data( packet_size * num_range_import );
+    Teuchos::ArrayView<const EntityId> send_data_view = send_data();
+    distributor.doPostsAndWaits( send_data_view, packet_size, import_data() );
 
-    // Redistribute the range entity ids.
-    Teuchos::ArrayView<const EntityId> send_ids_view = send_ids();
+    // Unpack the range entities.
     range_entity_ids.resize( num_range_import );
-    distributor.doPostsAndWaits( send_ids_view, 1, range_entity_ids() );
-
-    // Redistribute the range entity owner ranks.
-    Teuchos::ArrayView<const int> range_ranks_view = range_ranks();
     range_owner_ranks.resize( num_range_import );
-    distributor.doPostsAndWaits( range_ranks_view, 1, range_owner_ranks() );
-
-    // Redistribute the range entity centroids.
     range_centroids.resize( d_space_dim * num_range_import );
-    Teuchos::ArrayView<const double> send_centroids_view = send_centroids();
-    distributor.doPostsAndWaits( send_centroids_view, d_space_dim,
-                                 range_centroids() );
+    for ( int n = 0; n < num_range_import; ++n )
+    {
+        unpackRangeEntity( import_data( packet_size * n, packet_size ),
+                           range_entity_ids[n], range_owner_ranks[n],
+                           range_centroids( d_space_dim * n, d_space_dim ) );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -197,6 +298,41 @@ CoarseGlobalSearch::getMissedRangeEntityIds() const
     return d_missed_range_entity_ids();
 }
 
+//---------------------------------------------------------------------------//
+// Pack a range entity id, owner rank, and centroid into a message. The
+// centroid coordinates are copied bitwise.
+void CoarseGlobalSearch::packRangeEntity(
+    const EntityId entity_id, const int owner_rank,
+    const Teuchos::ArrayView<const double> &centroid,
+    Teuchos::Array<EntityId> &message ) const
+{
+    static_assert( sizeof( double ) <= sizeof( EntityId ),
+                   "Coordinates must fit in an entity id" );
+    message.push_back( entity_id );
+    message.push_back( Teuchos::as<EntityId>( owner_rank ) );
+    EntityId coord_bits = 0;
+    for ( auto coord : centroid )
+    {
+        std::memcpy( &coord_bits, &coord, sizeof( double ) );
+        message.push_back( coord_bits );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Unpack a range entity id, owner rank, and centroid from a message.
+void CoarseGlobalSearch::unpackRangeEntity(
+    const Teuchos::ArrayView<const EntityId> &message, EntityId &entity_id,
+    int &owner_rank, const Teuchos::ArrayView<double> &centroid ) const
+{
+    DTK_REQUIRE( message.size() == 2 + centroid.size() );
+    entity_id = message[0];
+    owner_rank = Teuchos::as<int>( message[1] );
+    for ( int d = 0; d < centroid.size(); ++d )
+    {
+        std::memcpy( &centroid[d], &message[2 + d], sizeof( double ) );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Assemble the local bounding box around an iterator.
 void CoarseGlobalSearch::assembleBoundingBox(
@@ -228,6 +364,125 @@ void CoarseGlobalSearch::assembleBoundingBox(
     }
 }
 
+//---------------------------------------------------------------------------//
+// Assemble a set of local bounding boxes around a set of entity boxes.
+void CoarseGlobalSearch::assembleSubBoxes(
+    const EntityBoundingBoxCache &entity_boxes,
+    Teuchos::Array<Teuchos::Tuple<double, 6>> &sub_boxes ) const
+{
+    // Start with empty boxes. These will remain empty if there are fewer
+    // entities than boxes.
+    double max = std::numeric_limits<double>::max();
+    sub_boxes.assign( d_num_sub_boxes,
+                      Teuchos::tuple( max, max, max, -max, -max, -max ) );
+
+    // Get the entity bounding boxes.
+    int num_entity = entity_boxes.size();
+    Teuchos::Array<Teuchos::Tuple<double, 6>> boxes( num_entity );
+    Teuchos::Array<int> entity_order( num_entity );
+    for ( int n = 0; n < num_entity; ++n )
+    {
+        entity_boxes.boundingBox( n, boxes[n] );
+        entity_order[n] = n;
+    }
+
+    // Bisect the entities into the sub-boxes.
+    if ( num_entity > 0 )
+    {
+        bisectBoxes( boxes, entity_order, 0, num_entity, sub_boxes() );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Recursively bisect a range of entity boxes into a range of sub-boxes.
+void CoarseGlobalSearch::bisectBoxes(
+    const Teuchos::Array<Teuchos::Tuple<double, 6>> &entity_boxes,
+    Teuchos::Array<int> &entity_order, const int begin, const int end,
+    Teuchos::ArrayView<Teuchos::Tuple<double, 6>> sub_boxes ) const
+{
+    // If there is only one sub-box or the entities cannot be split then
+    // bound all of the entities with the first sub-box.
+    int num_sub_boxes = sub_boxes.size();
+    if ( 1 == num_sub_boxes || end - begin < 2 )
+    {
+        for ( int n = begin; n < end; ++n )
+        {
+            const Teuchos::Tuple<double, 6> &entity_box =
+                entity_boxes[entity_order[n]];
+            for ( int d = 0; d < 3; ++d )
+            {
+                sub_boxes[0][d] = std::min( sub_boxes[0][d], entity_box[d] );
+                sub_boxes[0][d + 3] =
+                    std::max( sub_boxes[0][d + 3], entity_box[d + 3] );
+            }
+        }
+        return;
+    }
+
+    // Find the physical dimension with the largest extent of entity centers.
+    double max = std::numeric_limits<double>::max();
+    Teuchos::Tuple<double, 6> center_box =
+        Teuchos::tuple( max, max, max, -max, -max, -max );
+    double center = 0.0;
+    for ( int n = begin; n < end; ++n )
+    {
+        const Teuchos::Tuple<double, 6> &entity_box =
+            entity_boxes[entity_order[n]];
+        for ( int d = 0; d < d_space_dim; ++d )
+        {
+            center = 0.5 * entity_box[d] + 0.5 * entity_box[d + 3];
+            center_box[d] = std::min( center_box[d], center );
+            center_box[d + 3] = std::max( center_box[d + 3], center );
+        }
+    }
+    int axis = 0;
+    for ( int d = 1; d < d_space_dim; ++d )
+    {
+        if ( center_box[d + 3] - center_box[d] >
+             center_box[axis + 3] - center_box[axis] )
+        {
+            axis = d;
+        }
+    }
+
+    // Split the entities along that dimension in proportion to the number of
+    // sub-boxes on each side.
+    int num_left = num_sub_boxes / 2;
+    int mid = begin + Teuchos::as<int>( Teuchos::as<long long>( end - begin ) *
+                                        num_left / num_sub_boxes );
+    mid = std::max( mid, begin + 1 );
+    std::nth_element(
+        entity_order.begin() + begin, entity_order.begin() + mid,
+        entity_order.begin() + end, [&]( const int a, const int b ) {
+            return 0.5 * entity_boxes[a][axis] +
+                       0.5 * entity_boxes[a][axis + 3] <
+                   0.5 * entity_boxes[b][axis] +
+                       0.5 * entity_boxes[b][axis + 3];
+        } );
+
+    // Bisect each side.
+    bisectBoxes( entity_boxes, entity_order, begin, mid,
+                 sub_boxes( 0, num_left ) );
+    bisectBoxes( entity_boxes, entity_order, mid, end,
+                 sub_boxes( num_left, num_sub_boxes - num_left ) );
+}
+
+//---------------------------------------------------------------------------//
+// Grow a box by the inclusion tolerance in the physical dimensions.
+Teuchos::Tuple<double, 6>
+CoarseGlobalSearch::growBox( const Teuchos::Tuple<double, 6> &box ) const
+{
+    Teuchos::Tuple<double, 6> grown_box = box;
+    double tol = 0.0;
+    for ( int d = 0; d < d_space_dim; ++d )
+    {
+        tol = ( box[d + 3] - box[d] ) * d_inclusion_tol;
+        grown_box[d] -= tol;
+        grown_box[d + 3] += tol;
+    }
+    return grown_box;
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
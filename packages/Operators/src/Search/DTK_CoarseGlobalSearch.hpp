@@ -41,7 +41,9 @@
 #ifndef DTK_COARSEGLOBALSEARCH_HPP
 #define DTK_COARSEGLOBALSEARCH_HPP
 
+#include "DTK_BoundingVolumeHierarchy.hpp"
 #include "DTK_DBC.hpp"
+#include "DTK_EntityBoundingBoxCache.hpp"
 #include "DTK_EntityIterator.hpp"
 #include "DTK_EntityLocalMap.hpp"
 #include "DTK_Types.hpp"
@@ -59,6 +61,17 @@ namespace DataTransferKit
 /*!
  * \class CoarseGlobalSearch
  * \brief A CoarseGlobalSearch data structure for global entity coarse search.
+ *
+ * Each process publishes "Coarse Global Search Sub-Boxes" bounding boxes
+ * (default 1) around its domain entities. With more than one sub-box the
+ * local entities are recursively bisected at the median of their centers so
+ * that a non-convex partition is covered more tightly. This parameter must
+ * be the same on all processes.
+ *
+ * Two search types are available through the "Coarse Global Search Type"
+ * parameter. "Brute Force" (the default) tests the range entities against
+ * every box. "Bounding Volume Hierarchy" builds a tree over the gathered
+ * boxes so that each query is logarithmic in the number of boxes.
  */
 //---------------------------------------------------------------------------//
 class CoarseGlobalSearch
@@ -70,6 +83,12 @@ class CoarseGlobalSearch
                         const EntityIterator &domain_iterator,
                         const Teuchos::ParameterList &parameters );
 
+    // Constructor with the domain entity bounding boxes already computed.
+    CoarseGlobalSearch( const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+                        const int physical_dimension,
+                        const EntityBoundingBoxCache &domain_boxes,
+                        const Teuchos::ParameterList &parameters );
+
     // Redistribute a set of range entity centroid coordinates with their
     // owner ranks to the owning domain process.
     void search( const EntityIterator &range_iterator,
@@ -93,6 +112,31 @@ class CoarseGlobalSearch
     void assembleBoundingBox( const EntityIterator &entity_iterator,
                               Teuchos::Tuple<double, 6> &bounding_box ) const;
 
+    // Assemble a set of local bounding boxes around a set of entity boxes.
+    void assembleSubBoxes(
+        const EntityBoundingBoxCache &entity_boxes,
+        Teuchos::Array<Teuchos::Tuple<double, 6>> &sub_boxes ) const;
+
+    // Recursively bisect a range of entity boxes into a range of sub-boxes.
+    void bisectBoxes(
+        const Teuchos::Array<Teuchos::Tuple<double, 6>> &entity_boxes,
+        Teuchos::Array<int> &entity_order, const int begin, const int end,
+        Teuchos::ArrayView<Teuchos::Tuple<double, 6>> sub_boxes ) const;
+
+    // Pack a range entity id, owner rank, and centroid into a message.
+    void packRangeEntity( const EntityId entity_id, const int owner_rank,
+                          const Teuchos::ArrayView<const double> &centroid,
+                          Teuchos::Array<EntityId> &message ) const;
+
+    // Unpack a range entity id, owner rank, and centroid from a message.
+    void unpackRangeEntity( const Teuchos::ArrayView<const EntityId> &message,
+                            EntityId &entity_id, int &owner_rank,
+                            const Teuchos::ArrayView<double> &centroid ) const;
+
+    // Grow a box by the inclusion tolerance in the physical dimensions.
+    Teuchos::Tuple<double, 6>
+    growBox( const Teuchos::Tuple<double, 6> &box ) const;
+
     // Check if two bounding boxes have an intersection.
     inline bool boxesIntersect( const Teuchos::Tuple<double, 6> &box_A,
                                 const Teuchos::Tuple<double, 6> &box_B,
@@ -110,9 +154,18 @@ class CoarseGlobalSearch
     // Spatial dimension.
     int d_space_dim;
 
+    // Number of domain bounding boxes published by each process.
+    int d_num_sub_boxes;
+
     // Domain bounding boxes.
     Teuchos::Array<Teuchos::Tuple<double, 6>> d_domain_boxes;
 
+    // Domain bounding box owner ranks.
+    Teuchos::Array<int> d_domain_box_ranks;
+
+    // Bounding volume hierarchy over the domain boxes.
+    Teuchos::RCP<BoundingVolumeHierarchy> d_box_tree;
+
     // Boolean for tracking missed range entities.
     bool d_track_missed_range_entities;
 
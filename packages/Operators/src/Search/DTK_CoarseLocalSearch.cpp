@@ -55,40 +55,112 @@ CoarseLocalSearch::CoarseLocalSearch(
     const EntityIterator &entity_iterator,
     const Teuchos::RCP<EntityLocalMap> &local_map,
     const Teuchos::ParameterList &parameters )
+    : CoarseLocalSearch(
+          Teuchos::rcp( new EntityBoundingBoxCache( entity_iterator ) ),
+          local_map, parameters )
+{ /* ... */
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor with the entity bounding boxes already computed.
+ */
+CoarseLocalSearch::CoarseLocalSearch(
+    const Teuchos::RCP<const EntityBoundingBoxCache> &entity_boxes,
+    const Teuchos::RCP<EntityLocalMap> &local_map,
+    const Teuchos::ParameterList &parameters )
+    : d_use_boxes( false )
+    , d_space_dim( 0 )
+    , d_entity_boxes( entity_boxes )
 {
-    // Setup the centroid array. These will be interleaved.
-    int space_dim = 0;
-    int num_entity = entity_iterator.size();
-    if ( num_entity > 0 )
+    DTK_REQUIRE( Teuchos::nonnull( d_entity_boxes ) );
+
+    // Determine the type of search.
+    if ( parameters.isParameter( "Coarse Local Search Type" ) )
     {
-        space_dim = entity_iterator.begin()->physicalDimension();
+        if ( "Nearest Neighbor" ==
+             parameters.get<std::string>( "Coarse Local Search Type" ) )
+        {
+            d_use_boxes = false;
+        }
+        else if ( "Bounding Box" ==
+                  parameters.get<std::string>( "Coarse Local Search Type" ) )
+        {
+            d_use_boxes = true;
+        }
+        else
+        {
+            // Otherwise we got an invalid search type.
+            DTK_INSIST( false );
+        }
     }
-    d_entity_centroids.resize( space_dim * num_entity );
-
-    // Add the centroids.
-    EntityIterator entity_it;
-    EntityIterator begin_it = entity_iterator.begin();
-    EntityIterator end_it = entity_iterator.end();
-    int entity_local_id = 0;
-    for ( entity_it = begin_it; entity_it != end_it; ++entity_it )
+
+    // Get the entities.
+    int num_entity = d_entity_boxes->size();
+    if ( num_entity > 0 )
     {
-        local_map->centroid(
-            *entity_it,
-            d_entity_centroids( space_dim * entity_local_id, space_dim ) );
-        d_entity_map.emplace( entity_local_id, *entity_it );
-        ++entity_local_id;
+        d_space_dim = d_entity_boxes->entity( 0 ).physicalDimension();
     }
+    int space_dim = d_space_dim;
 
-    // Build a static search tree.
+    // Get the leaf size.
     int leaf_size = 20;
     if ( parameters.isParameter( "Coarse Local Search Leaf Size" ) )
     {
         leaf_size = parameters.get<int>( "Coarse Local Search Leaf Size" );
     }
-    leaf_size = std::min( leaf_size, num_entity );
-    d_tree = SearchTreeFactory::createStaticTree(
-        space_dim, d_entity_centroids(), leaf_size );
-    DTK_ENSURE( Teuchos::nonnull( d_tree ) );
+    leaf_size = std::max( 1, std::min( leaf_size, num_entity ) );
+
+    // Build a bounding volume hierarchy over the entity boxes.
+    if ( d_use_boxes )
+    {
+        // Get the point inclusion tolerance. The boxes are grown by this
+        // relative amount.
+        double tolerance = 1.0e-6;
+        if ( parameters.isParameter( "Point Inclusion Tolerance" ) )
+        {
+            tolerance = parameters.get<double>( "Point Inclusion Tolerance" );
+        }
+
+        // Add the boxes. These will be interleaved. Only the dimensions the
+        // entities live in are grown.
+        Teuchos::ArrayView<const double> cached_boxes =
+            d_entity_boxes->boundingBoxes();
+        Teuchos::Array<double> entity_boxes( cached_boxes );
+        double box_tol = 0.0;
+        for ( int n = 0; n < num_entity; ++n )
+        {
+            for ( int d = 0; d < space_dim; ++d )
+            {
+                box_tol = ( cached_boxes[6 * n + d + 3] -
+                            cached_boxes[6 * n + d] ) *
+                          tolerance;
+                entity_boxes[6 * n + d] -= box_tol;
+                entity_boxes[6 * n + d + 3] += box_tol;
+            }
+        }
+
+        d_bvh = Teuchos::rcp(
+            new BoundingVolumeHierarchy( entity_boxes(), leaf_size ) );
+        DTK_ENSURE( Teuchos::nonnull( d_bvh ) );
+    }
+
+    // Otherwise build a static search tree over the centroids.
+    else
+    {
+        // Add the centroids. These will be interleaved.
+        d_entity_centroids.resize( space_dim * num_entity );
+        for ( int n = 0; n < num_entity; ++n )
+        {
+            local_map->centroid(
+                d_entity_boxes->entity( n ),
+                d_entity_centroids( space_dim * n, space_dim ) );
+        }
+
+        d_tree = SearchTreeFactory::createStaticTree(
+            space_dim, d_entity_centroids(), leaf_size );
+        DTK_ENSURE( Teuchos::nonnull( d_tree ) );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -99,16 +171,9 @@ void CoarseLocalSearch::search( const Teuchos::ArrayView<const double> &point,
                                 const Teuchos::ParameterList &parameters,
                                 Teuchos::Array<Entity> &neighbors ) const
 {
-    // Find the leaf of nearest neighbors.
-    int num_neighbors = 100;
-    if ( parameters.isParameter( "Coarse Local Search kNN" ) )
-    {
-        num_neighbors = parameters.get<int>( "Coarse Local Search kNN" );
-    }
-    num_neighbors =
-        std::min( num_neighbors, Teuchos::as<int>( d_entity_map.size() ) );
-    Teuchos::Array<unsigned> local_neighbors =
-        d_tree->nnSearch( point, num_neighbors );
+    // Find the local ids of the neighbors.
+    Teuchos::Array<unsigned> local_neighbors;
+    searchLocalIds( point, parameters, local_neighbors );
 
     // Extract the neighbors.
     neighbors.resize( local_neighbors.size() );
@@ -117,8 +182,85 @@ void CoarseLocalSearch::search( const Teuchos::ArrayView<const double> &point,
     for ( local_it = local_neighbors.begin(), entity_it = neighbors.begin();
           local_it != local_neighbors.end(); ++local_it, ++entity_it )
     {
-        DTK_CHECK( d_entity_map.count( *local_it ) );
-        *entity_it = d_entity_map.find( *local_it )->second;
+        *entity_it = d_entity_boxes->entity( *local_it );
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Find the local ids in the bounding box cache of the entities a
+ * point neighbors.
+ */
+void CoarseLocalSearch::searchLocalIds(
+    const Teuchos::ArrayView<const double> &point,
+    const Teuchos::ParameterList &parameters,
+    Teuchos::Array<unsigned> &neighbors ) const
+{
+    // Find the entities whose bounding boxes contain the point.
+    if ( d_use_boxes )
+    {
+        d_bvh->pointSearch( point, neighbors );
+    }
+
+    // Or find the leaf of nearest neighbors.
+    else
+    {
+        int num_neighbors = 100;
+        if ( parameters.isParameter( "Coarse Local Search kNN" ) )
+        {
+            num_neighbors = parameters.get<int>( "Coarse Local Search kNN" );
+        }
+        num_neighbors = std::min( num_neighbors, d_entity_boxes->size() );
+        neighbors = d_tree->nnSearch( point, num_neighbors );
+    }
+    DTK_ENSURE( std::all_of( neighbors.begin(), neighbors.end(),
+                             [this]( const unsigned n ) {
+                                 return Teuchos::as<int>( n ) <
+                                        d_entity_boxes->size();
+                             } ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Find the local ids in the bounding box cache of the entities each
+ * point in a set of points neighbors.
+ */
+void CoarseLocalSearch::searchLocalIds(
+    const Teuchos::ArrayView<const double> &points,
+    const Teuchos::ParameterList &parameters, const bool threaded,
+    Teuchos::Array<std::size_t> &offsets,
+    Teuchos::Array<unsigned> &neighbors ) const
+{
+    DTK_REQUIRE( d_space_dim > 0 );
+    DTK_REQUIRE( 0 == points.size() % d_space_dim );
+
+    // Find the leaf of nearest neighbors of all the points at once.
+    if ( !d_use_boxes )
+    {
+        int num_neighbors = 100;
+        if ( parameters.isParameter( "Coarse Local Search kNN" ) )
+        {
+            num_neighbors = parameters.get<int>( "Coarse Local Search kNN" );
+        }
+        Teuchos::Array<double> squared_distances;
+        d_tree->nnSearch( points, num_neighbors, threaded, offsets, neighbors,
+                          squared_distances );
+        return;
+    }
+
+    // Otherwise find the entities whose bounding boxes contain each point.
+    int num_points = points.size() / d_space_dim;
+    offsets.resize( num_points + 1 );
+    offsets[0] = 0;
+    neighbors.clear();
+    Teuchos::Array<unsigned> point_neighbors;
+    for ( int n = 0; n < num_points; ++n )
+    {
+        d_bvh->pointSearch( points( d_space_dim * n, d_space_dim ),
+                            point_neighbors );
+        offsets[n + 1] = offsets[n] + point_neighbors.size();
+        neighbors.insert( neighbors.end(), point_neighbors.begin(),
+                          point_neighbors.end() );
     }
 }
 
@@ -41,8 +41,8 @@
 #ifndef DTK_COARSELOCALSEARCH_HPP
 #define DTK_COARSELOCALSEARCH_HPP
 
-#include <unordered_map>
-
+#include "DTK_BoundingVolumeHierarchy.hpp"
+#include "DTK_EntityBoundingBoxCache.hpp"
 #include "DTK_EntityIterator.hpp"
 #include "DTK_EntityLocalMap.hpp"
 #include "DTK_StaticSearchTree.hpp"
@@ -59,6 +59,13 @@ namespace DataTransferKit
 /*!
  * \class CoarseLocalSearch
  * \brief A CoarseLocalSearch data structure for local entity coarse search.
+ *
+ * Two search types are available through the "Coarse Local Search Type"
+ * parameter. "Nearest Neighbor" (the default) builds a kD-tree over the
+ * entity centroids and returns the "Coarse Local Search kNN" nearest
+ * entities. "Bounding Box" builds a bounding volume hierarchy over the
+ * entity bounding boxes and returns only the entities whose box contains the
+ * point.
  */
 //---------------------------------------------------------------------------//
 class CoarseLocalSearch
@@ -69,20 +76,50 @@ class CoarseLocalSearch
                        const Teuchos::RCP<EntityLocalMap> &local_map,
                        const Teuchos::ParameterList &parameters );
 
+    // Constructor with the entity bounding boxes already computed.
+    CoarseLocalSearch(
+        const Teuchos::RCP<const EntityBoundingBoxCache> &entity_boxes,
+        const Teuchos::RCP<EntityLocalMap> &local_map,
+        const Teuchos::ParameterList &parameters );
+
     // Find the set of entities a point neighbors.
     void search( const Teuchos::ArrayView<const double> &point,
                  const Teuchos::ParameterList &parameters,
                  Teuchos::Array<Entity> &neighbors ) const;
 
+    // Find the local ids in the bounding box cache of the entities a point
+    // neighbors.
+    void searchLocalIds( const Teuchos::ArrayView<const double> &point,
+                         const Teuchos::ParameterList &parameters,
+                         Teuchos::Array<unsigned> &neighbors ) const;
+
+    // Find the local ids in the bounding box cache of the entities each point
+    // in a set of interleaved points neighbors. The neighbors of point n are
+    // in [offsets[n],offsets[n+1]).
+    void searchLocalIds( const Teuchos::ArrayView<const double> &points,
+                         const Teuchos::ParameterList &parameters,
+                         const bool threaded,
+                         Teuchos::Array<std::size_t> &offsets,
+                         Teuchos::Array<unsigned> &neighbors ) const;
+
   private:
+    // Bounding box search flag.
+    bool d_use_boxes;
+
+    // Spatial dimension of the entities.
+    int d_space_dim;
+
     // Local mesh entity centroids.
     Teuchos::Array<double> d_entity_centroids;
 
-    // Local-id to entity map.
-    std::unordered_map<int, Entity> d_entity_map;
+    // Local entities and their bounding boxes indexed by local id.
+    Teuchos::RCP<const EntityBoundingBoxCache> d_entity_boxes;
 
     // Static search tree.
     Teuchos::RCP<StaticSearchTree> d_tree;
+
+    // Bounding volume hierarchy.
+    Teuchos::RCP<BoundingVolumeHierarchy> d_bvh;
 };
 
 //---------------------------------------------------------------------------//
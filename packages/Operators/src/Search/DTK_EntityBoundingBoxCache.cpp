@@ -0,0 +1,94 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file DTK_EntityBoundingBoxCache.cpp
+ * \author Stuart R. Slattery
+ * \brief EntityBoundingBoxCache definition.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+
+#include "DTK_DBC.hpp"
+#include "DTK_EntityBoundingBoxCache.hpp"
+#include "DTK_ThreadedBlocks.hpp"
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ */
+EntityBoundingBoxCache::EntityBoundingBoxCache(
+    const EntityIterator &entity_iterator, const bool threaded )
+{
+    entity_iterator.getEntities( d_entities );
+    int num_entity = d_entities.size();
+    d_boxes.resize( 6 * num_entity );
+
+    // Compute the boxes in contiguous blocks, one per thread.
+    int num_blocks = numThreadBlocks( num_entity, 1, threaded );
+    const Entity *entities = d_entities.getRawPtr();
+    double *boxes = d_boxes.getRawPtr();
+    forEachBlock(
+        num_entity, num_blocks,
+        [&]( const int, const int block_begin, const int block_end ) {
+            Teuchos::Tuple<double, 6> box;
+            for ( int n = block_begin; n < block_end; ++n )
+            {
+                entities[n].boundingBox( box );
+                std::copy( box.begin(), box.end(), boxes + 6 * n );
+            }
+        } );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the bounding box of an entity by local id.
+ */
+void EntityBoundingBoxCache::boundingBox(
+    const int n, Teuchos::Tuple<double, 6> &box ) const
+{
+    DTK_REQUIRE( n < size() );
+    std::copy( d_boxes.begin() + 6 * n, d_boxes.begin() + 6 * n + 6,
+               box.begin() );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// end DTK_EntityBoundingBoxCache.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file DTK_EntityBoundingBoxCache.hpp
+ * \author Stuart R. Slattery
+ * \brief EntityBoundingBoxCache declaration.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_ENTITYBOUNDINGBOXCACHE_HPP
+#define DTK_ENTITYBOUNDINGBOXCACHE_HPP
+
+#include "DTK_Entity.hpp"
+#include "DTK_EntityIterator.hpp"
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+#include <Teuchos_Tuple.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+  \class EntityBoundingBoxCache
+  \brief The bounding boxes of a set of entities indexed by local id.
+
+  Computing an entity bounding box walks the entity connectivity and node
+  coordinates. The boxes are computed once when the cache is built and stored
+  contiguously as (xmin,ymin,zmin,xmax,ymax,zmax) so that the global search,
+  the coarse local search, and the fine search safeguards can share them.
+ */
+//---------------------------------------------------------------------------//
+class EntityBoundingBoxCache
+{
+  public:
+    // Constructor. If threaded, the boxes are computed in parallel and the
+    // entity bounding box implementations must be thread-safe.
+    EntityBoundingBoxCache( const EntityIterator &entity_iterator,
+                            const bool threaded = false );
+
+    // Get the number of entities.
+    int size() const { return d_entities.size(); }
+
+    // Get an entity by local id.
+    const Entity &entity( const int n ) const { return d_entities[n]; }
+
+    // Get the entities.
+    Teuchos::ArrayView<const Entity> entities() const { return d_entities(); }
+
+    // Get the bounding box of an entity by local id.
+    void boundingBox( const int n, Teuchos::Tuple<double, 6> &box ) const;
+
+    // Get the interleaved bounding boxes of all entities.
+    Teuchos::ArrayView<const double> boundingBoxes() const
+    {
+        return d_boxes();
+    }
+
+  private:
+    // Entities indexed by local id.
+    Teuchos::Array<Entity> d_entities;
+
+    // Entity bounding boxes (6 per entity).
+    Teuchos::Array<double> d_boxes;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+#endif // DTK_ENTITYBOUNDINGBOXCACHE_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_EntityBoundingBoxCache.hpp
+//---------------------------------------------------------------------------//
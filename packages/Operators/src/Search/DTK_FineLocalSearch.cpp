@@ -96,6 +96,49 @@ void FineLocalSearch::search(
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Find the set of entities to which a point maps given the local ids
+ * of the neighbors in a bounding box cache.
+ */
+void FineLocalSearch::search(
+    const EntityBoundingBoxCache &entity_boxes,
+    const Teuchos::ArrayView<const unsigned> &neighbors,
+    const Teuchos::ArrayView<const double> &point,
+    const Teuchos::ParameterList &parameters, Teuchos::Array<Entity> &parents,
+    Teuchos::Array<double> &reference_coordinates ) const
+{
+    parents.clear();
+    reference_coordinates.clear();
+    int physical_dim = point.size();
+    Teuchos::Array<double> ref_point( physical_dim );
+    Teuchos::Tuple<double, 6> neighbor_box;
+    for ( auto n : neighbors )
+    {
+        const Entity &neighbor = entity_boxes.entity( n );
+        DTK_ENSURE( neighbor.physicalDimension() == point.size() );
+
+        entity_boxes.boundingBox( n, neighbor_box );
+        if ( d_local_map->isSafeToMapToReferenceFrame( neighbor, neighbor_box,
+                                                       point ) )
+        {
+            if ( d_local_map->mapToReferenceFrame( neighbor, point,
+                                                   ref_point() ) )
+            {
+                if ( d_local_map->checkPointInclusion( neighbor,
+                                                       ref_point() ) )
+                {
+                    parents.push_back( neighbor );
+                    for ( int d = 0; d < physical_dim; ++d )
+                    {
+                        reference_coordinates.push_back( ref_point[d] );
+                    }
+                }
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -44,6 +44,7 @@
 #include <unordered_map>
 
 #include "DTK_Entity.hpp"
+#include "DTK_EntityBoundingBoxCache.hpp"
 #include "DTK_EntityLocalMap.hpp"
 #include "DTK_Types.hpp"
 
@@ -74,6 +75,16 @@ class FineLocalSearch
                  Teuchos::Array<Entity> &parents,
                  Teuchos::Array<double> &reference_coordinates ) const;
 
+    // Find the set of entities to which a point maps given the local ids of
+    // the neighbors in a bounding box cache. The cached boxes are used for
+    // the mapping safeguard.
+    void search( const EntityBoundingBoxCache &entity_boxes,
+                 const Teuchos::ArrayView<const unsigned> &neighbors,
+                 const Teuchos::ArrayView<const double> &point,
+                 const Teuchos::ParameterList &parameters,
+                 Teuchos::Array<Entity> &parents,
+                 Teuchos::Array<double> &reference_coordinates ) const;
+
   private:
     // Local map for the fine search.
     Teuchos::RCP<EntityLocalMap> d_local_map;
@@ -38,13 +38,36 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+
 #include "DTK_ParallelSearch.hpp"
 #include "DTK_DBC.hpp"
+#include "DTK_ThreadedBlocks.hpp"
+
+#include <Teuchos_ConfigDefs.hpp>
+#include <Teuchos_TimeMonitor.hpp>
 
 #include <Tpetra_Distributor.hpp>
 
 namespace DataTransferKit
 {
+//---------------------------------------------------------------------------//
+namespace
+{
+// Find the position of an id in the sorted range [begin,end) of an array of
+// ids. Return -1 if the id is not in the range.
+int findSortedId( const Teuchos::Array<EntityId> &ids, const EntityId id,
+                  const int begin, const int end )
+{
+    auto first = ids.begin() + begin;
+    auto last = ids.begin() + end;
+    auto id_it = std::lower_bound( first, last, id );
+    return ( id_it != last && *id_it == id )
+               ? Teuchos::as<int>( std::distance( ids.begin(), id_it ) )
+               : -1;
+}
+} // end anonymous namespace
+
 //---------------------------------------------------------------------------//
 // Constructor.
 ParallelSearch::ParallelSearch(
@@ -55,6 +78,7 @@ ParallelSearch::ParallelSearch(
     : d_comm( comm )
     , d_physical_dim( physical_dimension )
     , d_track_missed_range_entities( false )
+    , d_threaded_local_search( false )
     , d_missed_range_entity_ids( 0 )
 {
     // Set the parameters with the local map.
@@ -67,17 +91,35 @@ ParallelSearch::ParallelSearch(
             parameters.get<bool>( "Track Missed Range Entities" );
     }
 
+    // Determine if we are threading the local search.
+    if ( parameters.isParameter( "Threaded Local Search" ) )
+    {
+        d_threaded_local_search =
+            parameters.get<bool>( "Threaded Local Search" );
+    }
+
+    // The threads copy domain entity handles. Their reference counts are
+    // only safe to change concurrently in a thread-safe Teuchos build.
+#ifndef HAVE_TEUCHOS_THREAD_SAFE
+    DTK_INSIST( !d_threaded_local_search );
+#endif
+
+    // Compute the domain entity bounding boxes once for all of the
+    // searches.
+    d_domain_boxes = Teuchos::rcp( new EntityBoundingBoxCache(
+        domain_iterator, d_threaded_local_search ) );
+
     // Build a coarse global search as this object must be collective across
     // the communicator.
     d_coarse_global_search = Teuchos::rcp( new CoarseGlobalSearch(
-        d_comm, physical_dimension, domain_iterator, parameters ) );
+        d_comm, physical_dimension, *d_domain_boxes, parameters ) );
 
     // Only do the local search if there are local domain entities.
-    d_empty_domain = ( 0 == domain_iterator.size() );
+    d_empty_domain = ( 0 == d_domain_boxes->size() );
     if ( !d_empty_domain )
     {
         d_coarse_local_search = Teuchos::rcp( new CoarseLocalSearch(
-            domain_iterator, domain_local_map, parameters ) );
+            d_domain_boxes, domain_local_map, parameters ) );
         d_fine_local_search =
             Teuchos::rcp( new FineLocalSearch( domain_local_map ) );
     }
@@ -98,10 +140,19 @@ void ParallelSearch::search(
     d_empty_range = ( 0 == range_iterator.size() );
 
     // Reset the state of the object.
-    d_range_owner_ranks.clear();
-    d_domain_to_range_map.clear();
-    d_range_to_domain_map.clear();
+    d_domain_ids.clear();
+    d_domain_offsets.assign( 1, 0 );
+    d_domain_range_ids.clear();
+    d_domain_range_ranks.clear();
     d_parametric_coords.clear();
+    d_range_owner_ids.clear();
+    d_range_owner_ranks.clear();
+    d_range_ids.clear();
+    d_range_offsets.assign( 1, 0 );
+    d_range_domain_ids.clear();
+    d_range_domain_ranks.clear();
+    d_domain_owner_ids.clear();
+    d_domain_owner_ranks.clear();
 
     // Perform a coarse global search to redistribute the range entities.
     Teuchos::Array<EntityId> range_entity_ids;
@@ -130,115 +181,222 @@ void ParallelSearch::search(
     Teuchos::Array<EntityId> export_data;
     if ( !d_empty_domain )
     {
-        // For each range centroid, perform a local search.
+        // Locate the range centroids in the local domain.
         int num_range = range_entity_ids.size();
-        Teuchos::Array<Entity> domain_neighbors;
-        Teuchos::Array<Entity> domain_parents;
+        Teuchos::Array<int> parent_offsets;
+        Teuchos::Array<EntityId> parent_ids;
         Teuchos::Array<double> reference_coordinates;
-        Teuchos::Array<double> local_coords( d_physical_dim );
-        int num_parents = 0;
+        localSearch( range_centroids(), parameters, parent_offsets, parent_ids,
+                     reference_coordinates );
+
+        // Extract the data to communicate back to the range parallel
+        // decomposition.
+        int num_pairs = parent_ids.size();
+        Teuchos::Array<int> pair_range( num_pairs );
+        export_range_ranks.resize( num_pairs );
+        export_data.resize( 3 * num_pairs );
         for ( int n = 0; n < num_range; ++n )
         {
-            // Perform a coarse local search to get the nearest domain
-            // entities to the point.
-            d_coarse_local_search->search(
-                range_centroids( d_physical_dim * n, d_physical_dim ),
-                parameters, domain_neighbors );
-
-            // Perform a fine local search to get the entities the point maps
-            // to.
-            d_fine_local_search->search(
-                domain_neighbors,
-                range_centroids( d_physical_dim * n, d_physical_dim ),
-                parameters, domain_parents, reference_coordinates );
-
-            // Store the potentially multiple parametric realizations of the
-            // point.
-            std::unordered_map<EntityId, Teuchos::Array<double>> ref_map;
-            num_parents = domain_parents.size();
-            for ( int p = 0; p < num_parents; ++p )
+            for ( int p = parent_offsets[n]; p < parent_offsets[n + 1]; ++p )
             {
-                // Store the range data in the domain parallel decomposition.
-                local_coords().assign( reference_coordinates(
-                    d_physical_dim * p, d_physical_dim ) );
-                d_range_owner_ranks.emplace( range_entity_ids[n],
-                                             range_owner_ranks[n] );
-                d_domain_to_range_map.emplace( domain_parents[p].id(),
-                                               range_entity_ids[n] );
-                ref_map.emplace( domain_parents[p].id(), local_coords );
-
-                // Extract the data to communicate back to the range parallel
-                // decomposition.
-                export_range_ranks.push_back( range_owner_ranks[n] );
-                export_data.push_back( range_entity_ids[n] );
-                export_data.push_back( domain_parents[p].id() );
-                export_data.push_back(
-                    Teuchos::as<EntityId>( d_comm->getRank() ) );
+                pair_range[p] = n;
+                export_range_ranks[p] = range_owner_ranks[n];
+                export_data[3 * p] = range_entity_ids[n];
+                export_data[3 * p + 1] = parent_ids[p];
+                export_data[3 * p + 2] =
+                    Teuchos::as<EntityId>( d_comm->getRank() );
             }
 
-            // If we found parents for the point, store them.
-            if ( num_parents > 0 )
+            // If we are tracking missed entities, also track those that we
+            // found so we can determine if an entity was found after being
+            // sent to multiple destinations.
+            if ( d_track_missed_range_entities )
             {
-                d_parametric_coords.emplace( range_entity_ids[n], ref_map );
-
-                // If we are tracking missed entities, also track those that
-                // we found so we can determine if an entity was found after
-                // being sent to multiple destinations.
-                if ( d_track_missed_range_entities )
+                if ( parent_offsets[n + 1] > parent_offsets[n] )
                 {
                     found_range_entity_ids.push_back( range_entity_ids[n] );
                     found_range_ranks.push_back( range_owner_ranks[n] );
                 }
+                else
+                {
+                    missed_range_entity_ids.push_back( range_entity_ids[n] );
+                    missed_range_ranks.push_back( range_owner_ranks[n] );
+                }
+            }
+        }
+
+        // Sort the found range entities by id so their owner ranks can be
+        // queried.
+        Teuchos::Array<int> owner_order( num_range );
+        for ( int n = 0; n < num_range; ++n )
+        {
+            owner_order[n] = n;
+        }
+        std::sort( owner_order.begin(), owner_order.end(),
+                   [&]( const int a, const int b ) {
+                       return range_entity_ids[a] < range_entity_ids[b];
+                   } );
+        for ( auto n : owner_order )
+        {
+            if ( parent_offsets[n + 1] > parent_offsets[n] &&
+                 ( d_range_owner_ids.empty() ||
+                   d_range_owner_ids.back() != range_entity_ids[n] ) )
+            {
+                d_range_owner_ids.push_back( range_entity_ids[n] );
+                d_range_owner_ranks.push_back( range_owner_ranks[n] );
             }
+        }
 
-            // Otherwise, if we are tracking missed entities report this.
-            else if ( d_track_missed_range_entities )
+        // Order the (domain,range) pairs by domain id and then by range id
+        // and build the domain-to-range graph.
+        Teuchos::Array<int> pair_order( num_pairs );
+        for ( int p = 0; p < num_pairs; ++p )
+        {
+            pair_order[p] = p;
+        }
+        std::sort( pair_order.begin(), pair_order.end(),
+                   [&]( const int a, const int b ) {
+                       return ( parent_ids[a] < parent_ids[b] ) ||
+                              ( parent_ids[a] == parent_ids[b] &&
+                                range_entity_ids[pair_range[a]] <
+                                    range_entity_ids[pair_range[b]] );
+                   } );
+        d_domain_offsets.clear();
+        d_domain_range_ids.resize( num_pairs );
+        d_domain_range_ranks.resize( num_pairs );
+        d_parametric_coords.resize( d_physical_dim * num_pairs );
+        for ( int k = 0; k < num_pairs; ++k )
+        {
+            int p = pair_order[k];
+            if ( d_domain_ids.empty() || d_domain_ids.back() != parent_ids[p] )
             {
-                missed_range_entity_ids.push_back( range_entity_ids[n] );
-                missed_range_ranks.push_back( range_owner_ranks[n] );
+                d_domain_ids.push_back( parent_ids[p] );
+                d_domain_offsets.push_back( k );
             }
+            d_domain_range_ids[k] = range_entity_ids[pair_range[p]];
+            d_domain_range_ranks[k] = range_owner_ranks[pair_range[p]];
+            auto coords_begin =
+                reference_coordinates.begin() + d_physical_dim * p;
+            std::copy( coords_begin, coords_begin + d_physical_dim,
+                       d_parametric_coords.begin() + d_physical_dim * k );
         }
+        d_domain_offsets.push_back( num_pairs );
     }
 
     // Back-communicate the domain entities in which we found each range
     // entity to complete the mapping.
-    Tpetra::Distributor domain_to_range_dist( d_comm );
-    int num_import =
-        domain_to_range_dist.createFromSends( export_range_ranks() );
-    Teuchos::Array<EntityId> domain_data( 3 * num_import );
-    Teuchos::ArrayView<const EntityId> export_data_view = export_data();
-    domain_to_range_dist.doPostsAndWaits( export_data_view, 3, domain_data() );
-
-    // Store the domain data in the range parallel decomposition.
+    auto comm_timer =
+        Teuchos::TimeMonitor::getNewCounter( "DTK: Search Communication" );
+    int num_import = 0;
+    Teuchos::Array<EntityId> domain_data;
+    {
+        Teuchos::TimeMonitor comm_monitor( *comm_timer );
+        Tpetra::Distributor domain_to_range_dist( d_comm );
+        num_import =
+            domain_to_range_dist.createFromSends( export_range_ranks() );
+        domain_data.resize( 3 * num_import );
+        Teuchos::ArrayView<const EntityId> export_data_view = export_data();
+        domain_to_range_dist.doPostsAndWaits( export_data_view, 3,
+                                              domain_data() );
+    }
+
+    // Order the imported (range,domain) pairs by range id and then by domain
+    // id and build the range-to-domain graph in the range parallel
+    // decomposition.
+    Teuchos::Array<int> import_order( num_import );
     for ( int i = 0; i < num_import; ++i )
     {
-        d_domain_owner_ranks.emplace( domain_data[3 * i + 1],
-                                      domain_data[3 * i + 2] );
-        d_range_to_domain_map.emplace( domain_data[3 * i],
-                                       domain_data[3 * i + 1] );
+        import_order[i] = i;
+    }
+    std::sort( import_order.begin(), import_order.end(),
+               [&]( const int a, const int b ) {
+                   return ( domain_data[3 * a] < domain_data[3 * b] ) ||
+                          ( domain_data[3 * a] == domain_data[3 * b] &&
+                            domain_data[3 * a + 1] < domain_data[3 * b + 1] );
+               } );
+    d_range_offsets.clear();
+    d_range_domain_ids.resize( num_import );
+    d_range_domain_ranks.resize( num_import );
+    for ( int k = 0; k < num_import; ++k )
+    {
+        int i = import_order[k];
+        if ( d_range_ids.empty() || d_range_ids.back() != domain_data[3 * i] )
+        {
+            d_range_ids.push_back( domain_data[3 * i] );
+            d_range_offsets.push_back( k );
+        }
+        d_range_domain_ids[k] = domain_data[3 * i + 1];
+        d_range_domain_ranks[k] = Teuchos::as<int>( domain_data[3 * i + 2] );
+    }
+    d_range_offsets.push_back( num_import );
+
+    // Sort the domain entities by id so their owner ranks can be queried.
+    Teuchos::Array<int> domain_order( num_import );
+    for ( int k = 0; k < num_import; ++k )
+    {
+        domain_order[k] = k;
+    }
+    std::sort( domain_order.begin(), domain_order.end(),
+               [&]( const int a, const int b ) {
+                   return d_range_domain_ids[a] < d_range_domain_ids[b];
+               } );
+    for ( auto k : domain_order )
+    {
+        if ( d_domain_owner_ids.empty() ||
+             d_domain_owner_ids.back() != d_range_domain_ids[k] )
+        {
+            d_domain_owner_ids.push_back( d_range_domain_ids[k] );
+            d_domain_owner_ranks.push_back( d_range_domain_ranks[k] );
+        }
     }
 
     // If we are tracking missed entities, back-communicate the missing entities
     // and found entities to determine which entities are actually missing.
     if ( d_track_missed_range_entities )
     {
-        // Back-communicate the missing entities.
-        Tpetra::Distributor missed_range_dist( d_comm );
-        int num_import_missed =
-            missed_range_dist.createFromSends( missed_range_ranks() );
-        Teuchos::Array<EntityId> import_missed( num_import_missed );
-        Teuchos::ArrayView<const EntityId> missed_view =
-            missed_range_entity_ids();
-        missed_range_dist.doPostsAndWaits( missed_view, 1, import_missed() );
-
-        // Back-communicate the found entities.
-        Tpetra::Distributor found_range_dist( d_comm );
-        int num_import_found =
-            found_range_dist.createFromSends( found_range_ranks() );
-        Teuchos::Array<EntityId> import_found( num_import_found );
-        Teuchos::ArrayView<const EntityId> found_view =
-            found_range_entity_ids();
-        found_range_dist.doPostsAndWaits( found_view, 1, import_found() );
+        // Back-communicate the missing and found entities together. Each
+        // packet is the entity id and a flag that is 1 if it was found.
+        Teuchos::Array<int> status_ranks( missed_range_ranks );
+        status_ranks.insert( status_ranks.end(), found_range_ranks.begin(),
+                             found_range_ranks.end() );
+        Teuchos::Array<EntityId> status_data;
+        status_data.reserve( 2 * status_ranks.size() );
+        for ( auto missed_id : missed_range_entity_ids )
+        {
+            status_data.push_back( missed_id );
+            status_data.push_back( 0 );
+        }
+        for ( auto found_id : found_range_entity_ids )
+        {
+            status_data.push_back( found_id );
+            status_data.push_back( 1 );
+        }
+        int num_import_status = 0;
+        Teuchos::Array<EntityId> import_status;
+        {
+            Teuchos::TimeMonitor comm_monitor( *comm_timer );
+            Tpetra::Distributor status_dist( d_comm );
+            num_import_status = status_dist.createFromSends( status_ranks() );
+            import_status.resize( 2 * num_import_status );
+            Teuchos::ArrayView<const EntityId> status_view = status_data();
+            status_dist.doPostsAndWaits( status_view, 2, import_status() );
+        }
+
+        // Split the imported entities.
+        Teuchos::Array<EntityId> import_missed;
+        Teuchos::Array<EntityId> import_found;
+        for ( int i = 0; i < num_import_status; ++i )
+        {
+            if ( import_status[2 * i + 1] )
+            {
+                import_found.push_back( import_status[2 * i] );
+            }
+            else
+            {
+                import_missed.push_back( import_status[2 * i] );
+            }
+        }
+        int num_import_missed = import_missed.size();
 
         // Create a unique list of missed entities.
         std::sort( import_missed.begin(), import_missed.end() );
@@ -285,13 +443,16 @@ void ParallelSearch::getRangeEntitiesFromDomain(
     const EntityId domain_id, Teuchos::Array<EntityId> &range_ids ) const
 {
     DTK_REQUIRE( !d_empty_domain );
-    auto domain_pair = d_domain_to_range_map.equal_range( domain_id );
-    range_ids.resize( std::distance( domain_pair.first, domain_pair.second ) );
-    auto range_it = range_ids.begin();
-    for ( auto domain_it = domain_pair.first; domain_it != domain_pair.second;
-          ++domain_it, ++range_it )
+    int row = findSortedId( d_domain_ids, domain_id, 0, d_domain_ids.size() );
+    if ( row < 0 )
+    {
+        range_ids.clear();
+    }
+    else
     {
-        *range_it = domain_it->second;
+        range_ids.assign( d_domain_range_ids.begin() + d_domain_offsets[row],
+                          d_domain_range_ids.begin() +
+                              d_domain_offsets[row + 1] );
     }
 }
 
@@ -302,13 +463,16 @@ void ParallelSearch::getDomainEntitiesFromRange(
     const EntityId range_id, Teuchos::Array<EntityId> &domain_ids ) const
 {
     DTK_REQUIRE( !d_empty_range );
-    auto range_pair = d_range_to_domain_map.equal_range( range_id );
-    domain_ids.resize( std::distance( range_pair.first, range_pair.second ) );
-    auto domain_it = domain_ids.begin();
-    for ( auto range_it = range_pair.first; range_it != range_pair.second;
-          ++range_it, ++domain_it )
+    int row = findSortedId( d_range_ids, range_id, 0, d_range_ids.size() );
+    if ( row < 0 )
+    {
+        domain_ids.clear();
+    }
+    else
     {
-        *domain_it = range_it->second;
+        domain_ids.assign( d_range_domain_ids.begin() + d_range_offsets[row],
+                           d_range_domain_ids.begin() +
+                               d_range_offsets[row + 1] );
     }
 }
 
@@ -317,8 +481,10 @@ void ParallelSearch::getDomainEntitiesFromRange(
 int ParallelSearch::rangeEntityOwnerRank( const EntityId range_id ) const
 {
     DTK_REQUIRE( !d_empty_domain );
-    DTK_REQUIRE( d_range_owner_ranks.count( range_id ) );
-    return d_range_owner_ranks.find( range_id )->second;
+    int k = findSortedId( d_range_owner_ids, range_id, 0,
+                          d_range_owner_ids.size() );
+    DTK_REQUIRE( k >= 0 );
+    return d_range_owner_ranks[k];
 }
 
 //---------------------------------------------------------------------------//
@@ -326,8 +492,10 @@ int ParallelSearch::rangeEntityOwnerRank( const EntityId range_id ) const
 int ParallelSearch::domainEntityOwnerRank( const EntityId domain_id ) const
 {
     DTK_REQUIRE( !d_empty_range );
-    DTK_REQUIRE( d_domain_owner_ranks.count( domain_id ) );
-    return d_domain_owner_ranks.find( domain_id )->second;
+    int k = findSortedId( d_domain_owner_ids, domain_id, 0,
+                          d_domain_owner_ids.size() );
+    DTK_REQUIRE( k >= 0 );
+    return d_domain_owner_ranks[k];
 }
 
 //---------------------------------------------------------------------------//
@@ -337,11 +505,43 @@ void ParallelSearch::rangeParametricCoordinatesInDomain(
     Teuchos::ArrayView<const double> &parametric_coords ) const
 {
     DTK_REQUIRE( !d_empty_domain );
-    DTK_REQUIRE( d_parametric_coords.count( range_id ) );
-    DTK_REQUIRE(
-        d_parametric_coords.find( range_id )->second.count( domain_id ) );
+    int row = findSortedId( d_domain_ids, domain_id, 0, d_domain_ids.size() );
+    DTK_REQUIRE( row >= 0 );
+    int k = findSortedId( d_domain_range_ids, range_id, d_domain_offsets[row],
+                          d_domain_offsets[row + 1] );
+    DTK_REQUIRE( k >= 0 );
     parametric_coords =
-        d_parametric_coords.find( range_id )->second.find( domain_id )->second;
+        d_parametric_coords( d_physical_dim * k, d_physical_dim );
+}
+
+//---------------------------------------------------------------------------//
+// Get the domain-to-range graph on a domain process.
+void ParallelSearch::getDomainToRangeGraph(
+    Teuchos::ArrayView<const EntityId> &domain_ids,
+    Teuchos::ArrayView<const int> &offsets,
+    Teuchos::ArrayView<const EntityId> &range_ids,
+    Teuchos::ArrayView<const int> &range_ranks,
+    Teuchos::ArrayView<const double> &parametric_coords ) const
+{
+    domain_ids = d_domain_ids();
+    offsets = d_domain_offsets();
+    range_ids = d_domain_range_ids();
+    range_ranks = d_domain_range_ranks();
+    parametric_coords = d_parametric_coords();
+}
+
+//---------------------------------------------------------------------------//
+// Get the range-to-domain graph on a range process.
+void ParallelSearch::getRangeToDomainGraph(
+    Teuchos::ArrayView<const EntityId> &range_ids,
+    Teuchos::ArrayView<const int> &offsets,
+    Teuchos::ArrayView<const EntityId> &domain_ids,
+    Teuchos::ArrayView<const int> &domain_ranks ) const
+{
+    range_ids = d_range_ids();
+    offsets = d_range_offsets();
+    domain_ids = d_range_domain_ids();
+    domain_ranks = d_range_domain_ranks();
 }
 
 //---------------------------------------------------------------------------//
@@ -354,6 +554,114 @@ ParallelSearch::getMissedRangeEntityIds() const
     return d_missed_range_entity_ids();
 }
 
+//---------------------------------------------------------------------------//
+// Locate a set of points in the local domain.
+void ParallelSearch::localSearch(
+    const Teuchos::ArrayView<const double> &points,
+    const Teuchos::ParameterList &parameters,
+    Teuchos::Array<int> &parent_offsets, Teuchos::Array<EntityId> &parent_ids,
+    Teuchos::Array<double> &reference_coordinates ) const
+{
+    DTK_REQUIRE( !d_empty_domain );
+    DTK_REQUIRE( 0 == points.size() % d_physical_dim );
+
+    int num_points = points.size() / d_physical_dim;
+
+    // Split the points into contiguous blocks, one per thread. Each block
+    // keeps its results in its own buffers. The buffers are merged in block
+    // order so the results do not depend on the number of threads.
+    int num_blocks = numThreadBlocks( num_points, 1, d_threaded_local_search );
+    Teuchos::Array<Teuchos::Array<std::size_t>> block_neighbor_offsets(
+        num_blocks );
+    Teuchos::Array<Teuchos::Array<unsigned>> block_neighbors( num_blocks );
+    Teuchos::Array<Teuchos::Array<int>> block_num_parents( num_blocks );
+    Teuchos::Array<Teuchos::Array<EntityId>> block_parent_ids( num_blocks );
+    Teuchos::Array<Teuchos::Array<double>> block_ref_coords( num_blocks );
+
+    // Perform a coarse local search to get the nearest domain entities to
+    // each point.
+    {
+        auto coarse_timer =
+            Teuchos::TimeMonitor::getNewCounter( "DTK: Coarse Local Search" );
+        Teuchos::TimeMonitor coarse_monitor( *coarse_timer );
+        forEachBlock(
+            num_points, num_blocks,
+            [&]( const int b, const int block_begin, const int block_end ) {
+                // Copy the parameters as reading a parameter list modifies
+                // it.
+                Teuchos::ParameterList block_parameters( parameters );
+                d_coarse_local_search->searchLocalIds(
+                    points( d_physical_dim * block_begin,
+                            d_physical_dim * ( block_end - block_begin ) ),
+                    block_parameters, false, block_neighbor_offsets[b],
+                    block_neighbors[b] );
+            } );
+    }
+
+    // Perform a fine local search to get the entities each point maps to.
+    {
+        auto fine_timer =
+            Teuchos::TimeMonitor::getNewCounter( "DTK: Fine Local Search" );
+        Teuchos::TimeMonitor fine_monitor( *fine_timer );
+        forEachBlock(
+            num_points, num_blocks,
+            [&]( const int b, const int block_begin, const int block_end ) {
+                Teuchos::ParameterList block_parameters( parameters );
+                Teuchos::Array<Entity> domain_parents;
+                Teuchos::Array<double> point_ref_coords;
+                block_num_parents[b].resize( block_end - block_begin );
+                for ( int n = block_begin; n < block_end; ++n )
+                {
+                    std::size_t neighbor_offset =
+                        block_neighbor_offsets[b][n - block_begin];
+                    d_fine_local_search->search(
+                        *d_domain_boxes,
+                        block_neighbors[b].view(
+                            neighbor_offset,
+                            block_neighbor_offsets[b][n - block_begin + 1] -
+                                neighbor_offset ),
+                        points( d_physical_dim * n, d_physical_dim ),
+                        block_parameters, domain_parents, point_ref_coords );
+
+                    // Store the results.
+                    block_num_parents[b][n - block_begin] =
+                        domain_parents.size();
+                    for ( auto &parent : domain_parents )
+                    {
+                        block_parent_ids[b].push_back( parent.id() );
+                    }
+                    block_ref_coords[b].insert( block_ref_coords[b].end(),
+                                                point_ref_coords.begin(),
+                                                point_ref_coords.end() );
+                }
+            } );
+    }
+
+    // Merge the block results.
+    parent_offsets.resize( num_points + 1 );
+    parent_offsets[0] = 0;
+    parent_ids.clear();
+    reference_coordinates.clear();
+    int n = 0;
+    for ( int b = 0; b < num_blocks; ++b )
+    {
+        for ( auto num_parents : block_num_parents[b] )
+        {
+            parent_offsets[n + 1] = parent_offsets[n] + num_parents;
+            ++n;
+        }
+        parent_ids.insert( parent_ids.end(), block_parent_ids[b].begin(),
+                           block_parent_ids[b].end() );
+        reference_coordinates.insert( reference_coordinates.end(),
+                                      block_ref_coords[b].begin(),
+                                      block_ref_coords[b].end() );
+    }
+    DTK_ENSURE( num_points == n );
+    DTK_ENSURE( parent_offsets.back() == parent_ids.size() );
+    DTK_ENSURE( d_physical_dim * parent_ids.size() ==
+                reference_coordinates.size() );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -41,10 +41,9 @@
 #ifndef DTK_PARALLELSEARCH_HPP
 #define DTK_PARALLELSEARCH_HPP
 
-#include <unordered_map>
-
 #include "DTK_CoarseGlobalSearch.hpp"
 #include "DTK_CoarseLocalSearch.hpp"
+#include "DTK_EntityBoundingBoxCache.hpp"
 #include "DTK_EntityIterator.hpp"
 #include "DTK_EntityLocalMap.hpp"
 #include "DTK_FineLocalSearch.hpp"
@@ -69,6 +68,23 @@ namespace DataTransferKit
   The search has two simultaneous states: one in the parallel decomposition of
   the domain and one in the parallel decomposition of the range. The interface
   functions assume one decomposition or the other.
+
+  The results are stored as compressed sparse row graphs sorted by entity id
+  and may be accessed in bulk through views of the graphs or one entity at a
+  time.
+
+  If DTK is built with OpenMP and the "Threaded Local Search" parameter is
+  true, the local search of the range centroids imported by the coarse global
+  search is split across threads. The domain entity bounding boxes are also
+  computed in parallel. The domain local map and the domain entity bounding
+  boxes must then be safe to compute concurrently. The threads copy domain
+  entity handles so Teuchos must also be built thread-safe. Requesting a
+  threaded search otherwise is an error. The results are identical to those
+  of the serial search.
+
+  The search phases are timed with the Teuchos timers "DTK: Coarse Global
+  Search", "DTK: Coarse Local Search", "DTK: Fine Local Search", and "DTK:
+  Search Communication".
 */
 //---------------------------------------------------------------------------//
 class ParallelSearch
@@ -125,6 +141,51 @@ class ParallelSearch
         const EntityId domain_id, const EntityId range_id,
         Teuchos::ArrayView<const double> &parametric_coords ) const;
 
+    /*!
+     * \brief Get the domain-to-range graph on a domain process.
+     *
+     * \param domain_ids The sorted ids of the local domain entities in which
+     * range entities were found.
+     *
+     * \param offsets The range entities found in domain_ids[i] are in the
+     * range [offsets[i],offsets[i+1]) of the range entity data.
+     *
+     * \param range_ids The ids of the range entities found in each domain
+     * entity sorted within each row.
+     *
+     * \param range_ranks The owner ranks of the range entities.
+     *
+     * \param parametric_coords The parametric coordinates of the range
+     * entities in the domain entities. The coordinates of range entity k are
+     * in [physical_dim*k,physical_dim*(k+1)).
+     */
+    void getDomainToRangeGraph(
+        Teuchos::ArrayView<const EntityId> &domain_ids,
+        Teuchos::ArrayView<const int> &offsets,
+        Teuchos::ArrayView<const EntityId> &range_ids,
+        Teuchos::ArrayView<const int> &range_ranks,
+        Teuchos::ArrayView<const double> &parametric_coords ) const;
+
+    /*!
+     * \brief Get the range-to-domain graph on a range process.
+     *
+     * \param range_ids The sorted ids of the local range entities that were
+     * found in domain entities.
+     *
+     * \param offsets The domain entities in which range_ids[i] was found are
+     * in the range [offsets[i],offsets[i+1]) of the domain entity data.
+     *
+     * \param domain_ids The ids of the domain entities in which each range
+     * entity was found sorted within each row.
+     *
+     * \param domain_ranks The owner ranks of the domain entities.
+     */
+    void
+    getRangeToDomainGraph( Teuchos::ArrayView<const EntityId> &range_ids,
+                           Teuchos::ArrayView<const int> &offsets,
+                           Teuchos::ArrayView<const EntityId> &domain_ids,
+                           Teuchos::ArrayView<const int> &domain_ranks ) const;
+
     /*!
      * \brief Return the ids of the range entities that were not during the
      * last search (i.e. those that are guaranteed to not receive data from
@@ -134,6 +195,16 @@ class ParallelSearch
      */
     Teuchos::ArrayView<const EntityId> getMissedRangeEntityIds() const;
 
+  private:
+    // Locate a set of points in the local domain. The parents of point n and
+    // the point's reference coordinates in each of them are given in the
+    // range [parent_offsets[n],parent_offsets[n+1]).
+    void localSearch( const Teuchos::ArrayView<const double> &points,
+                      const Teuchos::ParameterList &parameters,
+                      Teuchos::Array<int> &parent_offsets,
+                      Teuchos::Array<EntityId> &parent_ids,
+                      Teuchos::Array<double> &reference_coordinates ) const;
+
   private:
     // Parallel communicator.
     Teuchos::RCP<const Teuchos::Comm<int>> d_comm;
@@ -147,6 +218,9 @@ class ParallelSearch
     // Empty range flag.
     bool d_empty_range;
 
+    // Domain entity bounding boxes shared by the searches.
+    Teuchos::RCP<EntityBoundingBoxCache> d_domain_boxes;
+
     // Coarse global search.
     Teuchos::RCP<CoarseGlobalSearch> d_coarse_global_search;
 
@@ -156,28 +230,50 @@ class ParallelSearch
     // Fine local search.
     Teuchos::RCP<FineLocalSearch> d_fine_local_search;
 
-    // Range owner rank map.
-    std::unordered_map<EntityId, int> d_range_owner_ranks;
+    // Sorted ids of the domain entities in which range entities were found.
+    Teuchos::Array<EntityId> d_domain_ids;
 
-    // Domain owner rank map.
-    std::unordered_map<EntityId, int> d_domain_owner_ranks;
+    // Domain-to-range graph offsets.
+    Teuchos::Array<int> d_domain_offsets;
 
-    // Domain-to-range entity map.
-    std::unordered_multimap<EntityId, EntityId> d_domain_to_range_map;
+    // Ids of the range entities found in each domain entity.
+    Teuchos::Array<EntityId> d_domain_range_ids;
 
-    // Range-to-domain entity map.
-    std::unordered_multimap<EntityId, EntityId> d_range_to_domain_map;
+    // Owner ranks of the range entities found in each domain entity.
+    Teuchos::Array<int> d_domain_range_ranks;
 
-    // Parametric coordinates of the range entities in the domain
-    // entities. The first key is the range id, the second key is the domain
-    // id.
-    std::unordered_map<EntityId,
-                       std::unordered_map<EntityId, Teuchos::Array<double>>>
-        d_parametric_coords;
+    // Parametric coordinates of the range entities in the domain entities.
+    Teuchos::Array<double> d_parametric_coords;
+
+    // Sorted ids of the range entities found in the local domain and their
+    // owner ranks.
+    Teuchos::Array<EntityId> d_range_owner_ids;
+    Teuchos::Array<int> d_range_owner_ranks;
+
+    // Sorted ids of the local range entities found in domain entities.
+    Teuchos::Array<EntityId> d_range_ids;
+
+    // Range-to-domain graph offsets.
+    Teuchos::Array<int> d_range_offsets;
+
+    // Ids of the domain entities in which each range entity was found.
+    Teuchos::Array<EntityId> d_range_domain_ids;
+
+    // Owner ranks of the domain entities in which each range entity was
+    // found.
+    Teuchos::Array<int> d_range_domain_ranks;
+
+    // Sorted ids of the domain entities in which the local range entities
+    // were found and their owner ranks.
+    Teuchos::Array<EntityId> d_domain_owner_ids;
+    Teuchos::Array<int> d_domain_owner_ranks;
 
     // Boolean for tracking missed range entities.
     bool d_track_missed_range_entities;
 
+    // Boolean for threading the local search.
+    bool d_threaded_local_search;
+
     // An array of range entity ids that were not mapped during the last call
     // to setup.
     mutable Teuchos::Array<EntityId> d_missed_range_entity_ids;
@@ -39,7 +39,9 @@
 //---------------------------------------------------------------------------//
 
 #include <algorithm>
+#include <cstring>
 #include <unordered_map>
+#include <utility>
 
 #include "DTK_BasicEntityPredicates.hpp"
 #include "DTK_ConsistentInterpolationOperator.hpp"
@@ -47,7 +49,9 @@
 #include "DTK_ParallelSearch.hpp"
 #include "DTK_PredicateComposition.hpp"
 
+#include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_OrdinalTraits.hpp>
+#include <Teuchos_TimeMonitor.hpp>
 
 #include <Tpetra_Distributor.hpp>
 #include <Tpetra_Map.hpp>
@@ -97,80 +101,508 @@ void ConsistentInterpolationOperator::setupImpl(
     DTK_REQUIRE( Teuchos::nonnull( domain_space ) );
     DTK_REQUIRE( Teuchos::nonnull( range_space ) );
 
-    // Extract the Support maps.
-    const Teuchos::RCP<const typename Base::TpetraMap> domain_map =
-        this->getDomainMap();
-    const Teuchos::RCP<const typename Base::TpetraMap> range_map =
-        this->getRangeMap();
-
     // Get the parallel communicator.
-    Teuchos::RCP<const Teuchos::Comm<int>> comm = domain_map->getComm();
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        this->getDomainMap()->getComm();
+
+    // Get the physical dimension.
+    int physical_dimension = physicalDimension( domain_space, range_space );
+
+    // Get an iterator over the domain entities.
+    EntityIterator domain_iterator = domainIterator( domain_space );
+
+    // Build a parallel search over the domain.
+    ParallelSearch psearch( comm, physical_dimension, domain_iterator,
+                            domain_space->localMap(), d_search_list );
+
+    // Get an iterator over the range entities.
+    EntityIterator range_iterator =
+        rangeIterator( range_space, FunctionSpace::selectAll );
+
+    // Search the domain with the range.
+    psearch.search( range_iterator, range_space->localMap(), d_search_list );
+
+    // If we are keeping track of range entities that were not mapped, extract
+    // them.
+    d_missed_range_entity_ids =
+        Teuchos::Array<EntityId>( psearch.getMissedRangeEntityIds() );
+
+    // Extract the domain entities in which the local range entities were
+    // found.
+    Teuchos::ArrayView<const EntityId> found_range_ids;
+    Teuchos::ArrayView<const int> found_range_offsets;
+    Teuchos::ArrayView<const EntityId> range_domain_ids;
+    Teuchos::ArrayView<const int> range_domain_ranks;
+    psearch.getRangeToDomainGraph( found_range_ids, found_range_offsets,
+                                   range_domain_ids, range_domain_ranks );
+    d_range_pair_ids.clear();
+    for ( int i = 0; i < found_range_ids.size(); ++i )
+    {
+        for ( int k = found_range_offsets[i]; k < found_range_offsets[i + 1];
+              ++k )
+        {
+            d_range_pair_ids.push_back( found_range_ids[i] );
+        }
+    }
+    d_range_pair_domain_ids = Teuchos::Array<EntityId>( range_domain_ids );
+    d_range_pair_domain_ranks = Teuchos::Array<int>( range_domain_ranks );
+
+    // Build the coupling matrix from the domain entities in which range
+    // entities were found.
+    Teuchos::ArrayView<const EntityId> found_domain_ids;
+    Teuchos::ArrayView<const int> found_domain_offsets;
+    Teuchos::ArrayView<const EntityId> domain_range_ids;
+    Teuchos::ArrayView<const int> domain_range_ranks;
+    Teuchos::ArrayView<const double> parametric_coords;
+    psearch.getDomainToRangeGraph( found_domain_ids, found_domain_offsets,
+                                   domain_range_ids, domain_range_ranks,
+                                   parametric_coords );
+    buildCouplingMatrix( domain_space, range_space, domain_iterator,
+                         range_iterator, found_domain_ids,
+                         found_domain_offsets, domain_range_ids,
+                         parametric_coords, physical_dimension );
+}
+
+//---------------------------------------------------------------------------//
+// Update the map operator.
+void ConsistentInterpolationOperator::updateImpl(
+    const Teuchos::RCP<FunctionSpace> &domain_space,
+    const Teuchos::RCP<FunctionSpace> &range_space )
+{
+    DTK_REQUIRE( Teuchos::nonnull( domain_space ) );
+    DTK_REQUIRE( Teuchos::nonnull( range_space ) );
+    DTK_REQUIRE( Teuchos::nonnull( d_coupling_matrix ) );
 
-    // Determine if we have range and domain data on this process.
-    bool nonnull_domain = Teuchos::nonnull( domain_space->entitySet() );
-    bool nonnull_range = Teuchos::nonnull( range_space->entitySet() );
+    // Get the parallel communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        this->getDomainMap()->getComm();
 
     // Get the physical dimension.
+    int physical_dimension = physicalDimension( domain_space, range_space );
+
+    // Get iterators over the domain and range entities.
+    EntityIterator domain_iterator = domainIterator( domain_space );
+    EntityIterator range_iterator =
+        rangeIterator( range_space, FunctionSpace::selectAll );
+
+    // Set the parameters with the local maps.
+    if ( Teuchos::nonnull( domain_space->entitySet() ) )
+    {
+        domain_space->localMap()->setParameters( d_search_list );
+    }
+    if ( Teuchos::nonnull( range_space->entitySet() ) )
+    {
+        range_space->localMap()->setParameters( d_search_list );
+    }
+
+    // Send the new centroid of each range entity found during the last setup
+    // to the domain entities in which it was found. The messages contain the
+    // range entity id, the domain entity id, and the centroid. Range
+    // entities without pairs were missed by an earlier search and are
+    // searched for again.
+    static_assert( sizeof( double ) <= sizeof( EntityId ),
+                   "Coordinates must fit in an entity id" );
+    int packet_size = 2 + physical_dimension;
+    int num_pairs = d_range_pair_ids.size();
+    Teuchos::Array<int> export_pairs;
+    Teuchos::Array<int> export_ranks;
+    Teuchos::Array<EntityId> export_data;
+    Teuchos::Array<double> centroid( physical_dimension );
+    Teuchos::Array<EntityId>::iterator pair_begin;
+    Teuchos::Array<EntityId>::iterator pair_end;
+    EntityId coord_bits = 0;
+    Teuchos::Array<EntityId> unpaired_ids;
+    EntityIterator range_it;
+    EntityIterator range_begin = range_iterator.begin();
+    EntityIterator range_end = range_iterator.end();
+    for ( range_it = range_begin; range_it != range_end; ++range_it )
+    {
+        pair_begin = std::lower_bound( d_range_pair_ids.begin(),
+                                       d_range_pair_ids.end(), range_it->id() );
+        pair_end = std::upper_bound( pair_begin, d_range_pair_ids.end(),
+                                     range_it->id() );
+        if ( pair_begin == pair_end )
+        {
+            unpaired_ids.push_back( range_it->id() );
+            continue;
+        }
+
+        range_space->localMap()->centroid( *range_it, centroid() );
+        for ( int k = std::distance( d_range_pair_ids.begin(), pair_begin );
+              k < std::distance( d_range_pair_ids.begin(), pair_end ); ++k )
+        {
+            export_pairs.push_back( k );
+            export_ranks.push_back( d_range_pair_domain_ranks[k] );
+            export_data.push_back( d_range_pair_ids[k] );
+            export_data.push_back( d_range_pair_domain_ids[k] );
+            for ( auto coord : centroid )
+            {
+                std::memcpy( &coord_bits, &coord, sizeof( double ) );
+                export_data.push_back( coord_bits );
+            }
+        }
+    }
+    DTK_CHECK( export_pairs.size() == num_pairs );
+    Tpetra::Distributor check_dist( comm );
+    int num_check = check_dist.createFromSends( export_ranks() );
+    Teuchos::Array<EntityId> import_data( packet_size * num_check );
+    Teuchos::ArrayView<const EntityId> export_data_view = export_data();
+    check_dist.doPostsAndWaits( export_data_view, packet_size,
+                                import_data() );
+
+    // Check if the range entities are still in their domain entities.
+    Teuchos::Array<int> import_found( num_check, 0 );
+    Teuchos::Array<double> import_coords( physical_dimension * num_check );
+    Teuchos::Array<double> point( physical_dimension );
+    Entity domain_entity;
+    for ( int n = 0; n < num_check; ++n )
+    {
+        domain_space->entitySet()->getEntity(
+            import_data[packet_size * n + 1], physical_dimension,
+            domain_entity );
+        for ( int d = 0; d < physical_dimension; ++d )
+        {
+            std::memcpy( &point[d], &import_data[packet_size * n + 2 + d],
+                         sizeof( double ) );
+        }
+        Teuchos::ArrayView<double> ref_point =
+            import_coords( physical_dimension * n, physical_dimension );
+        if ( domain_space->localMap()->isSafeToMapToReferenceFrame(
+                 domain_entity, point() ) &&
+             domain_space->localMap()->mapToReferenceFrame(
+                 domain_entity, point(), ref_point ) &&
+             domain_space->localMap()->checkPointInclusion( domain_entity,
+                                                            ref_point ) )
+        {
+            import_found[n] = 1;
+        }
+    }
+
+    // Send the results of the check back to the range entities.
+    Teuchos::Array<int> export_found( num_pairs );
+    Teuchos::ArrayView<const int> import_found_view = import_found();
+    check_dist.doReversePostsAndWaits( import_found_view, 1, export_found() );
+
+    // Keep the pairs that were found again and collect the range entities
+    // that left all of their domain entities.
+    Teuchos::Array<int> pair_found( num_pairs );
+    for ( int p = 0; p < num_pairs; ++p )
+    {
+        pair_found[export_pairs[p]] = export_found[p];
+    }
+    Teuchos::Array<EntityId> search_ids;
+    Teuchos::Array<EntityId> range_pair_ids;
+    Teuchos::Array<EntityId> range_pair_domain_ids;
+    Teuchos::Array<int> range_pair_domain_ranks;
+    for ( int k = 0; k < num_pairs; ++k )
+    {
+        if ( pair_found[k] )
+        {
+            range_pair_ids.push_back( d_range_pair_ids[k] );
+            range_pair_domain_ids.push_back( d_range_pair_domain_ids[k] );
+            range_pair_domain_ranks.push_back( d_range_pair_domain_ranks[k] );
+        }
+
+        // The pairs are sorted by range entity id so the last pair of a
+        // range entity decides if it needs to be searched for again.
+        if ( k + 1 == num_pairs ||
+             d_range_pair_ids[k + 1] != d_range_pair_ids[k] )
+        {
+            if ( range_pair_ids.empty() ||
+                 range_pair_ids.back() != d_range_pair_ids[k] )
+            {
+                search_ids.push_back( d_range_pair_ids[k] );
+            }
+        }
+    }
+
+    // Also search for the range entities that were missed before.
+    search_ids.insert( search_ids.end(), unpaired_ids.begin(),
+                       unpaired_ids.end() );
+    std::sort( search_ids.begin(), search_ids.end() );
+    search_ids.erase( std::unique( search_ids.begin(), search_ids.end() ),
+                      search_ids.end() );
+
+    // Collect the domain entity to range entity pairs that were found again.
+    Teuchos::Array<EntityId> pair_domain_ids;
+    Teuchos::Array<EntityId> pair_range_ids;
+    Teuchos::Array<double> pair_coords;
+    for ( int n = 0; n < num_check; ++n )
+    {
+        if ( import_found[n] )
+        {
+            pair_range_ids.push_back( import_data[packet_size * n] );
+            pair_domain_ids.push_back( import_data[packet_size * n + 1] );
+            pair_coords.insert(
+                pair_coords.end(),
+                import_coords.begin() + physical_dimension * n,
+                import_coords.begin() + physical_dimension * ( n + 1 ) );
+        }
+    }
+
+    // Search the domain with the range entities that left their domain
+    // entities or were missed before. Only the range entities that are
+    // missed by this search remain missed.
+    d_missed_range_entity_ids.clear();
+    int global_num_search = 0;
+    int local_num_search = search_ids.size();
+    Teuchos::reduceAll( *comm, Teuchos::REDUCE_SUM, local_num_search,
+                        Teuchos::outArg( global_num_search ) );
+    if ( global_num_search > 0 )
+    {
+        PredicateFunction search_predicate = [&search_ids]( Entity e ) {
+            return std::binary_search( search_ids.begin(), search_ids.end(),
+                                       e.id() );
+        };
+        EntityIterator search_iterator =
+            rangeIterator( range_space, search_predicate );
+
+        ParallelSearch psearch( comm, physical_dimension, domain_iterator,
+                                domain_space->localMap(), d_search_list );
+        psearch.search( search_iterator, range_space->localMap(),
+                        d_search_list );
+
+        // The range entities that were not found are now the missed list.
+        Teuchos::ArrayView<const EntityId> missed_ids =
+            psearch.getMissedRangeEntityIds();
+        d_missed_range_entity_ids.assign( missed_ids.begin(),
+                                          missed_ids.end() );
+        std::sort( d_missed_range_entity_ids.begin(),
+                   d_missed_range_entity_ids.end() );
+
+        // Add the new range entity pairs.
+        Teuchos::ArrayView<const EntityId> found_range_ids;
+        Teuchos::ArrayView<const int> found_range_offsets;
+        Teuchos::ArrayView<const EntityId> range_domain_ids;
+        Teuchos::ArrayView<const int> range_domain_ranks;
+        psearch.getRangeToDomainGraph( found_range_ids, found_range_offsets,
+                                       range_domain_ids, range_domain_ranks );
+        for ( int i = 0; i < found_range_ids.size(); ++i )
+        {
+            for ( int k = found_range_offsets[i];
+                  k < found_range_offsets[i + 1]; ++k )
+            {
+                range_pair_ids.push_back( found_range_ids[i] );
+                range_pair_domain_ids.push_back( range_domain_ids[k] );
+                range_pair_domain_ranks.push_back( range_domain_ranks[k] );
+            }
+        }
+
+        // Add the new domain entity pairs.
+        Teuchos::ArrayView<const EntityId> found_domain_ids;
+        Teuchos::ArrayView<const int> found_domain_offsets;
+        Teuchos::ArrayView<const EntityId> domain_range_ids;
+        Teuchos::ArrayView<const int> domain_range_ranks;
+        Teuchos::ArrayView<const double> parametric_coords;
+        psearch.getDomainToRangeGraph( found_domain_ids, found_domain_offsets,
+                                       domain_range_ids, domain_range_ranks,
+                                       parametric_coords );
+        for ( int i = 0; i < found_domain_ids.size(); ++i )
+        {
+            for ( int k = found_domain_offsets[i];
+                  k < found_domain_offsets[i + 1]; ++k )
+            {
+                pair_domain_ids.push_back( found_domain_ids[i] );
+                pair_range_ids.push_back( domain_range_ids[k] );
+            }
+        }
+        pair_coords.insert( pair_coords.end(), parametric_coords.begin(),
+                            parametric_coords.end() );
+    }
+
+    // Sort the range entity pairs by range entity id.
+    int num_range_pairs = range_pair_ids.size();
+    Teuchos::Array<int> range_order( num_range_pairs );
+    for ( int k = 0; k < num_range_pairs; ++k )
+    {
+        range_order[k] = k;
+    }
+    std::sort( range_order.begin(), range_order.end(),
+               [&range_pair_ids]( const int a, const int b ) {
+                   return range_pair_ids[a] < range_pair_ids[b];
+               } );
+    d_range_pair_ids.resize( num_range_pairs );
+    d_range_pair_domain_ids.resize( num_range_pairs );
+    d_range_pair_domain_ranks.resize( num_range_pairs );
+    for ( int k = 0; k < num_range_pairs; ++k )
+    {
+        d_range_pair_ids[k] = range_pair_ids[range_order[k]];
+        d_range_pair_domain_ids[k] = range_pair_domain_ids[range_order[k]];
+        d_range_pair_domain_ranks[k] = range_pair_domain_ranks[range_order[k]];
+    }
+
+    // Build the domain entity to range entity graph sorted by domain entity
+    // id and then range entity id.
+    int num_domain_pairs = pair_domain_ids.size();
+    Teuchos::Array<int> domain_order( num_domain_pairs );
+    for ( int k = 0; k < num_domain_pairs; ++k )
+    {
+        domain_order[k] = k;
+    }
+    std::sort( domain_order.begin(), domain_order.end(),
+               [&pair_domain_ids, &pair_range_ids]( const int a, const int b ) {
+                   return ( pair_domain_ids[a] != pair_domain_ids[b] )
+                              ? pair_domain_ids[a] < pair_domain_ids[b]
+                              : pair_range_ids[a] < pair_range_ids[b];
+               } );
+    Teuchos::Array<EntityId> domain_ids;
+    Teuchos::Array<int> domain_offsets( 1, 0 );
+    Teuchos::Array<EntityId> range_ids( num_domain_pairs );
+    Teuchos::Array<double> parametric_coords( pair_coords.size() );
+    for ( int k = 0; k < num_domain_pairs; ++k )
+    {
+        int p = domain_order[k];
+        if ( domain_ids.empty() || domain_ids.back() != pair_domain_ids[p] )
+        {
+            domain_ids.push_back( pair_domain_ids[p] );
+            domain_offsets.push_back( k );
+        }
+        domain_offsets.back() = k + 1;
+        range_ids[k] = pair_range_ids[p];
+        std::copy( pair_coords.begin() + physical_dimension * p,
+                   pair_coords.begin() + physical_dimension * ( p + 1 ),
+                   parametric_coords.begin() + physical_dimension * k );
+    }
+
+    // Rebuild the coupling matrix. If no pairs were lost or found the
+    // structure of the coupling matrix has not changed and its values are
+    // refilled in place.
+    buildCouplingMatrix( domain_space, range_space, domain_iterator,
+                         range_iterator, domain_ids(), domain_offsets(),
+                         range_ids(), parametric_coords(),
+                         physical_dimension );
+}
+
+//---------------------------------------------------------------------------//
+// Apply the operator.
+void ConsistentInterpolationOperator::applyImpl( const TpetraMultiVector &X,
+                                                 TpetraMultiVector &Y,
+                                                 Teuchos::ETransp mode,
+                                                 double alpha,
+                                                 double beta ) const
+{
+    // If we want to keep the range data when we miss points, make a work vec
+    // and get the parts we will zero out. Beta must be zero or the interface
+    // is violated.
+    Teuchos::RCP<Tpetra::Vector<Scalar, LO, GO>> work_vec;
+    if ( d_keep_missed_sol )
+    {
+        DTK_REQUIRE( 0.0 == beta );
+        DTK_REQUIRE( Teuchos::nonnull( d_keep_range_vec ) );
+        work_vec = Tpetra::createVector<double, LO, GO>( this->getRangeMap() );
+        work_vec->elementWiseMultiply( 1.0, *d_keep_range_vec, Y, 0.0 );
+    }
+
+    // Apply the coupling matrix.
+    d_coupling_matrix->apply( X, Y, mode, alpha, beta );
+
+    // If we want to keep the range data when we miss points, add back in the
+    // components that got zeroed out.
+    if ( d_keep_missed_sol )
+    {
+        Y.update( 1.0, *work_vec, 1.0 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Transpose apply option.
+bool ConsistentInterpolationOperator::hasTransposeApplyImpl() const
+{
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Get the physical dimension of the function spaces.
+int ConsistentInterpolationOperator::physicalDimension(
+    const Teuchos::RCP<FunctionSpace> &domain_space,
+    const Teuchos::RCP<FunctionSpace> &range_space ) const
+{
     int physical_dimension = 0;
-    if ( nonnull_domain )
+    if ( Teuchos::nonnull( domain_space->entitySet() ) )
     {
         physical_dimension = domain_space->entitySet()->physicalDimension();
     }
-    else if ( nonnull_range )
+    else if ( Teuchos::nonnull( range_space->entitySet() ) )
     {
         physical_dimension = range_space->entitySet()->physicalDimension();
     }
+    return physical_dimension;
+}
 
-    // Get an iterator over the domain entities.
+//---------------------------------------------------------------------------//
+// Get an iterator over the locally-owned domain entities.
+EntityIterator ConsistentInterpolationOperator::domainIterator(
+    const Teuchos::RCP<FunctionSpace> &domain_space ) const
+{
     EntityIterator domain_iterator;
-    if ( nonnull_domain )
+    if ( Teuchos::nonnull( domain_space->entitySet() ) )
     {
         LocalEntityPredicate local_predicate(
             domain_space->entitySet()->communicator()->getRank() );
-        PredicateFunction domain_predicate = PredicateComposition::And(
-            domain_space->selectFunction(), local_predicate.getFunction() );
-        domain_iterator = domain_space->entitySet()->entityIterator(
-            domain_space->entitySet()->physicalDimension(), domain_predicate );
+        domain_iterator = domain_space->selectedEntityIterator(
+            domain_space->entitySet()->physicalDimension(),
+            local_predicate.getFunction() );
     }
+    return domain_iterator;
+}
 
-    // Build a parallel search over the domain.
-    ParallelSearch psearch( comm, physical_dimension, domain_iterator,
-                            domain_space->localMap(), d_search_list );
-
-    // Get an iterator over the range entities.
+//---------------------------------------------------------------------------//
+// Get an iterator over the locally-owned range entities that also satisfy the
+// given predicate.
+EntityIterator ConsistentInterpolationOperator::rangeIterator(
+    const Teuchos::RCP<FunctionSpace> &range_space,
+    const PredicateFunction &predicate ) const
+{
     EntityIterator range_iterator;
-    if ( nonnull_range )
+    if ( Teuchos::nonnull( range_space->entitySet() ) )
     {
         LocalEntityPredicate local_predicate(
             range_space->entitySet()->communicator()->getRank() );
-        PredicateFunction range_predicate = PredicateComposition::And(
-            range_space->selectFunction(), local_predicate.getFunction() );
-        range_iterator = range_space->entitySet()->entityIterator(
-            d_range_entity_dim, range_predicate );
+        range_iterator = range_space->selectedEntityIterator(
+            d_range_entity_dim,
+            PredicateComposition::And( local_predicate.getFunction(),
+                                       predicate ) );
     }
+    return range_iterator;
+}
 
-    // Search the domain with the range.
-    psearch.search( range_iterator, range_space->localMap(), d_search_list );
+//---------------------------------------------------------------------------//
+// Build the coupling matrix.
+void ConsistentInterpolationOperator::buildCouplingMatrix(
+    const Teuchos::RCP<FunctionSpace> &domain_space,
+    const Teuchos::RCP<FunctionSpace> &range_space,
+    const EntityIterator &domain_iterator, const EntityIterator &range_iterator,
+    const Teuchos::ArrayView<const EntityId> &domain_ids,
+    const Teuchos::ArrayView<const int> &domain_offsets,
+    const Teuchos::ArrayView<const EntityId> &range_ids,
+    const Teuchos::ArrayView<const double> &parametric_coords,
+    const int physical_dimension )
+{
+    auto timer = Teuchos::TimeMonitor::getNewCounter( "DTK: Matrix Fill" );
+    Teuchos::TimeMonitor monitor( *timer );
 
-    // If we are keeping track of range entities that were not mapped, extract
-    // them.
-    d_missed_range_entity_ids =
-        Teuchos::Array<EntityId>( psearch.getMissedRangeEntityIds() );
+    // Extract the Support maps.
+    const Teuchos::RCP<const typename Base::TpetraMap> domain_map =
+        this->getDomainMap();
+    const Teuchos::RCP<const typename Base::TpetraMap> range_map =
+        this->getRangeMap();
+
+    // Get the parallel communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = domain_map->getComm();
+    int comm_rank = comm->getRank();
 
-    // Determine the Support ids for the range entities found in the local
-    // domain
-    // on this process and the number of domain entities they were found in
-    // globally for averaging.
-    std::unordered_map<EntityId, GO> range_support_id_map;
-    Teuchos::RCP<Tpetra::Vector<double, int, SupportId>> scale_vector =
-        Tpetra::createVector<double, int, SupportId>( range_map );
+    // Determine the Support ids and owning ranks for the range entities
+    // found in the local domain on this process and the number of domain
+    // entities they were found in globally for averaging.
+    std::unordered_map<EntityId, std::pair<GO, int>> range_support_id_map;
+    Teuchos::Array<double> row_scales( range_map->getNodeNumElements(), 0.0 );
     {
         // Extract the set of local range entities that were found in domain
         // entities.
         Teuchos::Array<int> export_ranks;
         Teuchos::Array<GO> export_data;
-        Teuchos::Array<EntityId> domain_ids;
-        Teuchos::Array<EntityId>::const_iterator domain_id_it;
+        Teuchos::Array<EntityId>::const_iterator pair_begin;
+        Teuchos::Array<EntityId>::const_iterator pair_end;
         Teuchos::Array<GO> range_support_ids;
         EntityIterator range_it;
         EntityIterator range_begin = range_iterator.begin();
@@ -183,23 +615,27 @@ void ConsistentInterpolationOperator::setupImpl(
             DTK_CHECK( 1 == range_support_ids.size() );
 
             // Get the domain entities in which the range entity was found.
-            psearch.getDomainEntitiesFromRange( range_it->id(), domain_ids );
+            pair_begin = std::lower_bound( d_range_pair_ids.begin(),
+                                           d_range_pair_ids.end(),
+                                           range_it->id() );
+            pair_end = std::upper_bound( pair_begin, d_range_pair_ids.end(),
+                                         range_it->id() );
 
-            // Add a scale factor for this range entity to the scaling vector.
+            // Add a scale factor for this range entity to its row.
             DTK_CHECK( range_map->isNodeGlobalElement( range_support_ids[0] ) );
-            scale_vector->replaceGlobalValue( range_support_ids[0],
-                                              1.0 / domain_ids.size() );
+            row_scales[range_map->getLocalElement( range_support_ids[0] )] =
+                1.0 / std::distance( pair_begin, pair_end );
 
             // For each supporting domain entity, pair the range entity id and
             // its support id.
-            for ( domain_id_it = domain_ids.begin();
-                  domain_id_it != domain_ids.end(); ++domain_id_it )
+            for ( auto pair_it = pair_begin; pair_it != pair_end; ++pair_it )
             {
-                export_ranks.push_back(
-                    psearch.domainEntityOwnerRank( *domain_id_it ) );
+                export_ranks.push_back( d_range_pair_domain_ranks[std::distance(
+                    d_range_pair_ids.begin(), pair_it )] );
 
                 export_data.push_back( range_support_ids[0] );
                 export_data.push_back( Teuchos::as<GO>( range_it->id() ) );
+                export_data.push_back( Teuchos::as<GO>( comm_rank ) );
             }
         }
 
@@ -207,51 +643,55 @@ void ConsistentInterpolationOperator::setupImpl(
         // decomposition.
         Tpetra::Distributor range_to_domain_dist( comm );
         int num_import = range_to_domain_dist.createFromSends( export_ranks() );
-        Teuchos::Array<GO> import_data( 2 * num_import );
+        Teuchos::Array<GO> import_data( 3 * num_import );
         Teuchos::ArrayView<const GO> export_data_view = export_data();
-        range_to_domain_dist.doPostsAndWaits( export_data_view, 2,
+        range_to_domain_dist.doPostsAndWaits( export_data_view, 3,
                                               import_data() );
 
-        // Map the range entities to their support ids.
+        // Map the range entities to their support ids and owning ranks.
         for ( int i = 0; i < num_import; ++i )
         {
             range_support_id_map.emplace(
-                Teuchos::as<EntityId>( import_data[2 * i + 1] ),
-                import_data[2 * i] );
+                Teuchos::as<EntityId>( import_data[3 * i + 1] ),
+                std::make_pair( import_data[3 * i],
+                                Teuchos::as<int>( import_data[3 * i + 2] ) ) );
         }
     }
 
-    // Allocate the coupling matrix.
-    d_coupling_matrix = Tpetra::createCrsMatrix<double, LO, GO>( range_map );
-
-    // Construct the entries of the coupling matrix.
-    Teuchos::Array<EntityId> range_entity_ids;
-    Teuchos::Array<EntityId>::const_iterator range_entity_id_it;
+    // Construct the entries of the coupling matrix in the domain
+    // decomposition.
+    Teuchos::Array<int> entry_ranks;
+    Teuchos::Array<GO> entry_indices;
+    Teuchos::Array<double> entry_values;
+    Teuchos::ArrayView<const EntityId>::iterator found_it;
     Teuchos::ArrayView<const double> range_parametric_coords;
     Teuchos::Array<double> domain_shape_values;
-    Teuchos::Array<double>::iterator domain_shape_it;
     Teuchos::Array<GO> domain_support_ids;
     EntityIterator domain_it;
     EntityIterator domain_begin = domain_iterator.begin();
     EntityIterator domain_end = domain_iterator.end();
     for ( domain_it = domain_begin; domain_it != domain_end; ++domain_it )
     {
+        // Get the range entities that mapped into this domain entity.
+        found_it = std::lower_bound( domain_ids.begin(), domain_ids.end(),
+                                     domain_it->id() );
+        if ( found_it == domain_ids.end() || *found_it != domain_it->id() )
+        {
+            continue;
+        }
+        int row = std::distance( domain_ids.begin(), found_it );
+
         // Get the domain Support ids supporting the domain entity.
         domain_space->shapeFunction()->entitySupportIds( *domain_it,
                                                          domain_support_ids );
 
-        // Get the range entities that mapped into this domain entity.
-        psearch.getRangeEntitiesFromDomain( domain_it->id(), range_entity_ids );
-
-        // Sum into the global coupling matrix row for each domain.
-        for ( range_entity_id_it = range_entity_ids.begin();
-              range_entity_id_it != range_entity_ids.end();
-              ++range_entity_id_it )
+        // Add an entry to the coupling matrix row of each range entity.
+        for ( int k = domain_offsets[row]; k < domain_offsets[row + 1]; ++k )
         {
             // Get the parametric coordinates of the range entity in the
             // domain entity.
-            psearch.rangeParametricCoordinatesInDomain(
-                domain_it->id(), *range_entity_id_it, range_parametric_coords );
+            range_parametric_coords = parametric_coords(
+                physical_dimension * k, physical_dimension );
 
             // Evaluate the shape function at the coordinates.
             domain_space->shapeFunction()->evaluateValue(
@@ -260,72 +700,175 @@ void ConsistentInterpolationOperator::setupImpl(
                        domain_support_ids.size() );
 
             // Consistent interpolation requires one support location per
-            // range entity. Load the row for this range support location into
-            // the matrix.
-            DTK_CHECK( range_support_id_map.count( *range_entity_id_it ) );
-            d_coupling_matrix->insertGlobalValues(
-                range_support_id_map.find( *range_entity_id_it )->second,
-                domain_support_ids(), domain_shape_values() );
+            // range entity. Send the row for this range support location to
+            // the process that owns it.
+            DTK_CHECK( range_support_id_map.count( range_ids[k] ) );
+            const std::pair<GO, int> &range_support =
+                range_support_id_map.find( range_ids[k] )->second;
+            for ( int n = 0; n < domain_support_ids.size(); ++n )
+            {
+                entry_ranks.push_back( range_support.second );
+                entry_indices.push_back( range_support.first );
+                entry_indices.push_back( domain_support_ids[n] );
+                entry_values.push_back( domain_shape_values[n] );
+            }
         }
     }
 
-    // Finalize the coupling matrix.
-    d_coupling_matrix->fillComplete( domain_map, range_map );
-
-    // Left-scale the matrix with the number of domain entities in which each
-    // range entity was found.
-    d_coupling_matrix->leftScale( *scale_vector );
+    // Move the entries to the processes that own their rows.
+    Tpetra::Distributor entry_dist( comm );
+    int num_entries = entry_dist.createFromSends( entry_ranks() );
+    Teuchos::Array<GO> import_indices( 2 * num_entries );
+    Teuchos::ArrayView<const GO> entry_indices_view = entry_indices();
+    entry_dist.doPostsAndWaits( entry_indices_view, 2, import_indices() );
+    Teuchos::Array<double> import_values( num_entries );
+    Teuchos::ArrayView<const double> entry_values_view = entry_values();
+    entry_dist.doPostsAndWaits( entry_values_view, 1, import_values() );
+
+    // Sort the entries by row and column and sum the duplicates to get the
+    // exact local row sizes.
+    Teuchos::Array<int> entry_order( num_entries );
+    for ( int n = 0; n < num_entries; ++n )
+    {
+        entry_order[n] = n;
+    }
+    std::sort( entry_order.begin(), entry_order.end(),
+               [&import_indices]( const int a, const int b ) {
+                   return ( import_indices[2 * a] != import_indices[2 * b] )
+                              ? import_indices[2 * a] < import_indices[2 * b]
+                              : import_indices[2 * a + 1] <
+                                    import_indices[2 * b + 1];
+               } );
+    LO num_rows = range_map->getNodeNumElements();
+    Teuchos::ArrayRCP<std::size_t> row_sizes( num_rows, 0 );
+    Teuchos::Array<LO> row_offsets( num_rows + 1, 0 );
+    Teuchos::Array<GO> columns;
+    Teuchos::Array<double> values;
+    LO local_row = 0;
+    for ( int n = 0; n < num_entries; ++n )
+    {
+        GO row_id = import_indices[2 * entry_order[n]];
+        GO column_id = import_indices[2 * entry_order[n] + 1];
+        double value = import_values[entry_order[n]];
+        local_row = range_map->getLocalElement( row_id );
+        DTK_CHECK( Teuchos::OrdinalTraits<LO>::invalid() != local_row );
+        if ( n > 0 && row_id == import_indices[2 * entry_order[n - 1]] &&
+             column_id == columns.back() )
+        {
+            values.back() += row_scales[local_row] * value;
+        }
+        else
+        {
+            columns.push_back( column_id );
+            values.push_back( row_scales[local_row] * value );
+            ++row_sizes[local_row];
+        }
+    }
+    for ( LO r = 0; r < num_rows; ++r )
+    {
+        row_offsets[r + 1] = row_offsets[r] + row_sizes[r];
+    }
 
-    // If we want to keep the range data when we miss points, create the
-    // scaling vector.
-    if ( d_keep_missed_sol )
+    // Check if the structure of the existing graph matches the new entries.
+    // Every row must hold exactly the same columns as the graph row or
+    // replacing the values would silently drop entries. If it matches on
+    // all processes only the values need to be replaced.
+    Teuchos::Array<LO> local_columns( columns.size() );
+    int local_same = Teuchos::nonnull( d_coupling_graph ) ? 1 : 0;
+    if ( local_same )
     {
-        d_keep_range_vec = Tpetra::createVector<double, LO, GO>( range_map );
-        for ( auto &m : d_missed_range_entity_ids )
+        Teuchos::ArrayView<const LO> graph_columns;
+        Teuchos::Array<LO> sorted_graph_columns;
+        Teuchos::Array<LO> sorted_row_columns;
+        for ( LO r = 0; r < num_rows && local_same; ++r )
         {
-            d_keep_range_vec->replaceGlobalValue( m, 1.0 );
+            d_coupling_graph->getLocalRowView( r, graph_columns );
+            if ( Teuchos::as<std::size_t>( graph_columns.size() ) !=
+                 row_sizes[r] )
+            {
+                local_same = 0;
+                break;
+            }
+            for ( LO j = row_offsets[r]; j < row_offsets[r + 1]; ++j )
+            {
+                local_columns[j] =
+                    d_coupling_graph->getColMap()->getLocalElement(
+                        columns[j] );
+                if ( Teuchos::OrdinalTraits<LO>::invalid() ==
+                     local_columns[j] )
+                {
+                    local_same = 0;
+                    break;
+                }
+            }
+            if ( !local_same )
+            {
+                break;
+            }
+            sorted_graph_columns.assign( graph_columns.begin(),
+                                         graph_columns.end() );
+            std::sort( sorted_graph_columns.begin(),
+                       sorted_graph_columns.end() );
+            sorted_row_columns.assign(
+                local_columns.begin() + row_offsets[r],
+                local_columns.begin() + row_offsets[r + 1] );
+            std::sort( sorted_row_columns.begin(), sorted_row_columns.end() );
+            if ( sorted_row_columns != sorted_graph_columns )
+            {
+                local_same = 0;
+            }
         }
     }
-}
+    int global_same = 0;
+    Teuchos::reduceAll( *comm, Teuchos::REDUCE_MIN, local_same,
+                        Teuchos::outArg( global_same ) );
 
-//---------------------------------------------------------------------------//
-// Apply the operator.
-void ConsistentInterpolationOperator::applyImpl( const TpetraMultiVector &X,
-                                                 TpetraMultiVector &Y,
-                                                 Teuchos::ETransp mode,
-                                                 double alpha,
-                                                 double beta ) const
-{
-    // If we want to keep the range data when we miss points, make a work vec
-    // and get the parts we will zero out. Beta must be zero or the interface
-    // is violated.
-    Teuchos::RCP<Tpetra::Vector<Scalar, LO, GO>> work_vec;
-    if ( d_keep_missed_sol )
+    // If the structure changed build a new graph with static profile from
+    // the exact row sizes.
+    if ( !global_same )
     {
-        DTK_REQUIRE( 0.0 == beta );
-        DTK_REQUIRE( Teuchos::nonnull( d_keep_range_vec ) );
-        work_vec = Tpetra::createVector<double, LO, GO>( this->getRangeMap() );
-        work_vec->elementWiseMultiply( 1.0, *d_keep_range_vec, Y, 0.0 );
+        Teuchos::RCP<Tpetra::CrsGraph<LO, GO>> graph =
+            Teuchos::rcp( new Tpetra::CrsGraph<LO, GO>(
+                range_map, row_sizes.getConst(), Tpetra::StaticProfile ) );
+        for ( LO r = 0; r < num_rows; ++r )
+        {
+            graph->insertGlobalIndices(
+                range_map->getGlobalElement( r ),
+                columns( row_offsets[r], row_sizes[r] ) );
+        }
+        graph->fillComplete( domain_map, range_map );
+        d_coupling_graph = graph;
+        d_coupling_matrix = Teuchos::rcp(
+            new Tpetra::CrsMatrix<Scalar, LO, GO>( d_coupling_graph ) );
+        for ( int j = 0; j < columns.size(); ++j )
+        {
+            local_columns[j] =
+                d_coupling_graph->getColMap()->getLocalElement( columns[j] );
+        }
     }
 
-    // Apply the coupling matrix.
-    d_coupling_matrix->apply( X, Y, mode, alpha, beta );
+    // Fill the values of the coupling matrix.
+    d_coupling_matrix->resumeFill();
+    for ( LO r = 0; r < num_rows; ++r )
+    {
+        d_coupling_matrix->replaceLocalValues(
+            r, local_columns( row_offsets[r], row_sizes[r] ),
+            values( row_offsets[r], row_sizes[r] ) );
+    }
+    d_coupling_matrix->fillComplete( domain_map, range_map );
 
-    // If we want to keep the range data when we miss points, add back in the
-    // components that got zeroed out.
+    // If we want to keep the range data when we miss points, create the
+    // scaling vector.
     if ( d_keep_missed_sol )
     {
-        Y.update( 1.0, *work_vec, 1.0 );
+        d_keep_range_vec = Tpetra::createVector<double, LO, GO>( range_map );
+        for ( auto &m : d_missed_range_entity_ids )
+        {
+            d_keep_range_vec->replaceGlobalValue( m, 1.0 );
+        }
     }
 }
 
-//---------------------------------------------------------------------------//
-// Transpose apply option.
-bool ConsistentInterpolationOperator::hasTransposeApplyImpl() const
-{
-    return true;
-}
-
 //---------------------------------------------------------------------------//
 // Return the ids of the range entities that were not mapped during the last
 // setup phase (i.e. those that are guaranteed to not receive data from the
@@ -48,6 +48,7 @@
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 
+#include <Tpetra_CrsGraph.hpp>
 #include <Tpetra_CrsMatrix.hpp>
 #include <Tpetra_Map.hpp>
 #include <Tpetra_Vector.hpp>
@@ -115,6 +116,24 @@ class ConsistentInterpolationOperator : virtual public MapOperator
     void setupImpl( const Teuchos::RCP<FunctionSpace> &domain_space,
                     const Teuchos::RCP<FunctionSpace> &range_space ) override;
 
+    /*!
+     * \brief Update the map operator after the domain and/or range entities
+     * have moved. Each range entity is first checked against the domain
+     * entities in which it was found during the last setup or update. Only
+     * the range entities that left all of those domain entities are searched
+     * for again. If no range entity changed its domain entities the values
+     * of the coupling matrix are refilled in place. The parallel
+     * decompositions of the function spaces must not have changed since the
+     * last setup. Range entities that were missed during the last setup or
+     * update are searched for again.
+     *
+     * \param domain_space The function space used to setup the domain.
+     *
+     * \param range_space The function space used to setup the range.
+     */
+    void updateImpl( const Teuchos::RCP<FunctionSpace> &domain_space,
+                     const Teuchos::RCP<FunctionSpace> &range_space ) override;
+
     /*!
      * \brief Apply the operator.
      */
@@ -130,6 +149,37 @@ class ConsistentInterpolationOperator : virtual public MapOperator
     bool hasTransposeApplyImpl() const override;
 
   private:
+    // Get the physical dimension of the function spaces.
+    int physicalDimension(
+        const Teuchos::RCP<FunctionSpace> &domain_space,
+        const Teuchos::RCP<FunctionSpace> &range_space ) const;
+
+    // Get an iterator over the locally-owned domain entities.
+    EntityIterator
+    domainIterator( const Teuchos::RCP<FunctionSpace> &domain_space ) const;
+
+    // Get an iterator over the locally-owned range entities that also satisfy
+    // the given predicate.
+    EntityIterator
+    rangeIterator( const Teuchos::RCP<FunctionSpace> &range_space,
+                   const PredicateFunction &predicate ) const;
+
+    // Build the coupling matrix from the current range entity pairs and the
+    // domain entity to range entity graph. The entries are moved to the
+    // processes that own their rows and the matrix graph is built with
+    // static profile from the exact row sizes. If the structure of the
+    // existing graph matches the entries only the values are replaced.
+    void buildCouplingMatrix(
+        const Teuchos::RCP<FunctionSpace> &domain_space,
+        const Teuchos::RCP<FunctionSpace> &range_space,
+        const EntityIterator &domain_iterator,
+        const EntityIterator &range_iterator,
+        const Teuchos::ArrayView<const EntityId> &domain_ids,
+        const Teuchos::ArrayView<const int> &domain_offsets,
+        const Teuchos::ArrayView<const EntityId> &range_ids,
+        const Teuchos::ArrayView<const double> &parametric_coords,
+        const int physical_dimension );
+
     // Range entity topological dimension. Default is 0 (vertex).
     int d_range_entity_dim;
 
@@ -140,13 +190,23 @@ class ConsistentInterpolationOperator : virtual public MapOperator
     // Search sublist.
     Teuchos::ParameterList d_search_list;
 
+    // The coupling matrix graph.
+    Teuchos::RCP<const Tpetra::CrsGraph<LO, GO>> d_coupling_graph;
+
     // The coupling matrix.
     Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> d_coupling_matrix;
 
     // An array of range entity ids that were not mapped during the last call
-    // to setup.
+    // to setup or update.
     Teuchos::Array<EntityId> d_missed_range_entity_ids;
 
+    // The local range entities found during the last setup or update sorted
+    // by id and the domain entities and their owning ranks in which they
+    // were found.
+    Teuchos::Array<EntityId> d_range_pair_ids;
+    Teuchos::Array<EntityId> d_range_pair_domain_ids;
+    Teuchos::Array<int> d_range_pair_domain_ranks;
+
     // The missed range entity update vector.
     Teuchos::RCP<Tpetra::Vector<Scalar, LO, GO>> d_keep_range_vec;
 };
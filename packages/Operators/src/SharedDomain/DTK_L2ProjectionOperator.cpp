@@ -46,9 +46,9 @@
 #include "DTK_IntegrationPoint.hpp"
 #include "DTK_L2ProjectionOperator.hpp"
 #include "DTK_ParallelSearch.hpp"
-#include "DTK_PredicateComposition.hpp"
 
 #include <Teuchos_OrdinalTraits.hpp>
+#include <Teuchos_TimeMonitor.hpp>
 
 #include <Teuchos_XMLParameterListCoreHelpers.hpp>
 
@@ -105,10 +105,9 @@ void L2ProjectionOperator::setupImpl(
     {
         LocalEntityPredicate local_predicate(
             domain_space->entitySet()->communicator()->getRank() );
-        PredicateFunction domain_predicate = PredicateComposition::And(
-            domain_space->selectFunction(), local_predicate.getFunction() );
-        domain_iterator = domain_space->entitySet()->entityIterator(
-            domain_space->entitySet()->physicalDimension(), domain_predicate );
+        domain_iterator = domain_space->selectedEntityIterator(
+            domain_space->entitySet()->physicalDimension(),
+            local_predicate.getFunction() );
     }
 
     // Get an iterator over the range entities.
@@ -117,10 +116,9 @@ void L2ProjectionOperator::setupImpl(
     {
         LocalEntityPredicate local_predicate(
             range_space->entitySet()->communicator()->getRank() );
-        PredicateFunction range_predicate = PredicateComposition::And(
-            range_space->selectFunction(), local_predicate.getFunction() );
-        range_iterator = range_space->entitySet()->entityIterator(
-            range_space->entitySet()->physicalDimension(), range_predicate );
+        range_iterator = range_space->selectedEntityIterator(
+            range_space->entitySet()->physicalDimension(),
+            local_predicate.getFunction() );
     }
 
     // Assemble the mass matrix over the range entity set.
@@ -220,6 +218,9 @@ void L2ProjectionOperator::assembleMassMatrix(
     Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> &mass_matrix,
     Teuchos::RCP<IntegrationPointSet> &range_ip_set )
 {
+    auto timer = Teuchos::TimeMonitor::getNewCounter( "DTK: Matrix Fill" );
+    Teuchos::TimeMonitor monitor( *timer );
+
     // Initialize output variables.
     Teuchos::RCP<const Teuchos::Comm<int>> range_comm =
         range_space->entitySet()->communicator();
@@ -337,6 +338,9 @@ void L2ProjectionOperator::assembleCouplingMatrix(
     EntityIterator ip_iterator = range_ip_set->entityIterator();
     psearch.search( ip_iterator, range_ip_set, d_search_list );
 
+    auto timer = Teuchos::TimeMonitor::getNewCounter( "DTK: Matrix Fill" );
+    Teuchos::TimeMonitor monitor( *timer );
+
     // Extract the set of local range entities that were found in domain
     // entities.
     int global_max_support = range_ip_set->globalMaxSupportSize();
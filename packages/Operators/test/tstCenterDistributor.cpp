@@ -38,6 +38,7 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <sstream>
@@ -188,6 +189,79 @@ TEUCHOS_UNIT_TEST( CenterDistributor, dim_3_test )
     }
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CenterDistributor, cells_test )
+{
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = getDefaultComm();
+    int rank = comm->getRank();
+    int size = comm->getSize();
+    int inverse_rank = size - rank - 1;
+
+    int dim = 2;
+    int num_src_points = 11;
+    int num_src_coords = dim * num_src_points;
+
+    Teuchos::Array<double> src_coords( num_src_coords );
+    for ( int i = 0; i < num_src_points; ++i )
+    {
+        src_coords[dim * i] = 1.0 * i;
+        src_coords[dim * i + 1] = 2.0 * rank;
+    }
+
+    // Put the targets at the ends of the line of sources so the bounding box
+    // of the targets covers all of the sources.
+    int num_tgt_points = 2;
+    int num_tgt_coords = dim * num_tgt_points;
+    Teuchos::Array<double> tgt_coords( num_tgt_coords );
+    tgt_coords[0] = 0.0;
+    tgt_coords[1] = 2.0 * inverse_rank;
+    tgt_coords[2] = 10.0;
+    tgt_coords[3] = 2.0 * inverse_rank;
+
+    double radius = 1.5;
+
+    // With bounding boxes all sources are sent.
+    Teuchos::Array<double> tgt_decomp_src;
+    DataTransferKit::CenterDistributor<2> box_distributor(
+        comm, src_coords(), tgt_coords(), radius, tgt_decomp_src );
+    TEST_EQUALITY( num_src_points, box_distributor.getNumImports() );
+
+    // With cells only the sources near the occupied cells are sent. The
+    // cells are at least as large as the expanded radius so the sources in
+    // the cells neighboring those with targets are sent as well.
+    DataTransferKit::CenterDistributor<2> cell_distributor(
+        comm, src_coords(), tgt_coords(), radius, tgt_decomp_src, true );
+    int num_import = 7;
+    TEST_EQUALITY( num_import, cell_distributor.getNumImports() );
+    TEST_EQUALITY( dim * cell_distributor.getNumImports(),
+                   tgt_decomp_src.size() );
+    Teuchos::Array<double> import_x( num_import );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        import_x[i] = tgt_decomp_src[dim * i];
+        TEST_EQUALITY( tgt_decomp_src[dim * i + 1], 2.0 * inverse_rank );
+    }
+    std::sort( import_x.begin(), import_x.end() );
+    double gold_x[7] = {0.0, 1.0, 2.0, 3.0, 8.0, 9.0, 10.0};
+    for ( int i = 0; i < num_import; ++i )
+    {
+        TEST_EQUALITY( import_x[i], gold_x[i] );
+    }
+
+    Teuchos::Array<double> src_data( num_src_points );
+    for ( int i = 0; i < num_src_points; ++i )
+    {
+        src_data[i] = i * inverse_rank;
+    }
+    Teuchos::Array<double> tgt_data( cell_distributor.getNumImports() );
+    Teuchos::ArrayView<const double> src_view = src_data();
+    cell_distributor.distribute( src_view, tgt_data() );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        TEST_EQUALITY( tgt_data[i], tgt_decomp_src[dim * i] * rank );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end tstCenterDistributor.cpp
 //---------------------------------------------------------------------------//
@@ -44,6 +44,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include <DTK_BasicEntitySet.hpp>
@@ -930,6 +931,88 @@ TEUCHOS_UNIT_TEST( CoarseGlobalSearch, missed_range_test )
                    Teuchos::as<EntityId>( num_points * comm_rank + 1000 ) );
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CoarseGlobalSearch, sub_box_test )
+{
+    using namespace DataTransferKit;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+
+    // Make a domain entity set with two boxes on each process separated by a
+    // gap.
+    Teuchos::RCP<EntitySet> domain_set =
+        Teuchos::rcp( new BasicEntitySet( comm, 3 ) );
+    int id = 2 * comm_rank;
+    Teuchos::rcp_dynamic_cast<BasicEntitySet>( domain_set )
+        ->addEntity( BoxGeometry( id, comm_rank, id, 0.0, 0.0, comm_rank, 1.0,
+                                  1.0, comm_rank + 1.0 ) );
+    Teuchos::rcp_dynamic_cast<BasicEntitySet>( domain_set )
+        ->addEntity( BoxGeometry( id + 1, comm_rank, id + 1, 9.0, 0.0,
+                                  comm_rank, 10.0, 1.0, comm_rank + 1.0 ) );
+    EntityIterator domain_it = domain_set->entityIterator( 3 );
+
+    // Make a range entity set with one point in a box and one in the gap.
+    Teuchos::RCP<EntitySet> range_set =
+        Teuchos::rcp( new BasicEntitySet( comm, 3 ) );
+    Teuchos::Array<double> point( 3 );
+    point[0] = 0.5;
+    point[1] = 0.5;
+    point[2] = comm_rank + 0.5;
+    Teuchos::rcp_dynamic_cast<BasicEntitySet>( range_set )
+        ->addEntity( Point( id, comm_rank, point ) );
+    point[0] = 5.0;
+    Teuchos::rcp_dynamic_cast<BasicEntitySet>( range_set )
+        ->addEntity( Point( id + 1, comm_rank, point ) );
+    EntityIterator range_it = range_set->entityIterator( 0 );
+    Teuchos::RCP<EntityLocalMap> range_map =
+        Teuchos::rcp( new BasicGeometryLocalMap() );
+
+    // Search with a single box per process. The point in the gap is sent to
+    // the process.
+    Teuchos::Array<EntityId> range_ids;
+    Teuchos::Array<int> range_ranks;
+    Teuchos::Array<double> range_centroids;
+    {
+        Teuchos::ParameterList plist;
+        plist.set<bool>( "Track Missed Range Entities", true );
+        CoarseGlobalSearch coarse_global_search( comm, 3, domain_it, plist );
+        coarse_global_search.search( range_it, range_map, plist, range_ids,
+                                     range_ranks, range_centroids );
+        TEST_EQUALITY( range_ids.size(), 2 );
+        TEST_EQUALITY( coarse_global_search.getMissedRangeEntityIds().size(),
+                       0 );
+    }
+
+    // Search with two boxes per process with both search types. The point in
+    // the gap is missed.
+    Teuchos::Array<std::string> search_types( 2 );
+    search_types[0] = "Brute Force";
+    search_types[1] = "Bounding Volume Hierarchy";
+    for ( auto &search_type : search_types )
+    {
+        Teuchos::ParameterList plist;
+        plist.set<bool>( "Track Missed Range Entities", true );
+        plist.set<int>( "Coarse Global Search Sub-Boxes", 2 );
+        plist.set<std::string>( "Coarse Global Search Type", search_type );
+        CoarseGlobalSearch coarse_global_search( comm, 3, domain_it, plist );
+        coarse_global_search.search( range_it, range_map, plist, range_ids,
+                                     range_ranks, range_centroids );
+        TEST_EQUALITY( range_ids.size(), 1 );
+        TEST_EQUALITY( range_ids[0], Teuchos::as<EntityId>( id ) );
+        TEST_EQUALITY( range_ranks[0], comm_rank );
+        TEST_EQUALITY( range_centroids[0], 0.5 );
+        TEST_EQUALITY( range_centroids[1], 0.5 );
+        TEST_EQUALITY( range_centroids[2], comm_rank + 0.5 );
+        Teuchos::ArrayView<const EntityId> missed_range =
+            coarse_global_search.getMissedRangeEntityIds();
+        TEST_EQUALITY( missed_range.size(), 1 );
+        TEST_EQUALITY( missed_range[0], Teuchos::as<EntityId>( id + 1 ) );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end tstCoarseGlobalSearch.cpp
 //---------------------------------------------------------------------------//
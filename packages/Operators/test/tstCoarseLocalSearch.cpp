@@ -50,6 +50,8 @@
 #include <DTK_BasicGeometryLocalMap.hpp>
 #include <DTK_BoxGeometry.hpp>
 #include <DTK_CoarseLocalSearch.hpp>
+#include <DTK_EntityBoundingBoxCache.hpp>
+#include <DTK_FineLocalSearch.hpp>
 
 #include <Teuchos_Array.hpp>
 #include <Teuchos_DefaultComm.hpp>
@@ -130,6 +132,129 @@ TEUCHOS_UNIT_TEST( CoarseLocalSearch, coarse_local_search_test )
     TEST_EQUALITY( 3, neighbors[1].id() );
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CoarseLocalSearch, bounding_box_search_test )
+{
+    using namespace DataTransferKit;
+
+    // Make an entity set.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    Teuchos::RCP<EntitySet> entity_set =
+        Teuchos::rcp( new BasicEntitySet( comm, 3 ) );
+
+    // Add some boxes to the set.
+    int num_boxes = 5;
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        Teuchos::rcp_dynamic_cast<BasicEntitySet>( entity_set )
+            ->addEntity( BoxGeometry( i, comm->getRank(), i, 0.0, 0.0, i, 1.0,
+                                      1.0, i + 1 ) );
+    }
+
+    // Construct a local map for the boxes.
+    Teuchos::RCP<EntityLocalMap> local_map =
+        Teuchos::rcp( new BasicGeometryLocalMap() );
+
+    // Get an iterator over all of the boxes.
+    EntityIterator all_it = entity_set->entityIterator( 3 );
+
+    // Build a coarse local search over the box bounding boxes.
+    Teuchos::ParameterList plist;
+    plist.set<std::string>( "Coarse Local Search Type", "Bounding Box" );
+    plist.set<int>( "Coarse Local Search Leaf Size", 2 );
+    CoarseLocalSearch coarse_local_search( all_it, local_map, plist );
+
+    // Make a point to search with. Only the box containing it is a neighbor.
+    Teuchos::Array<double> point( 3 );
+    point[0] = 0.5;
+    point[1] = 0.5;
+    point[2] = 2.2;
+    Teuchos::Array<Entity> neighbors;
+    coarse_local_search.search( point(), plist, neighbors );
+    TEST_EQUALITY( 1, neighbors.size() );
+    TEST_EQUALITY( 2, neighbors[0].id() );
+
+    // Make a point on a shared face.
+    point[2] = 3.0;
+    coarse_local_search.search( point(), plist, neighbors );
+    TEST_EQUALITY( 2, neighbors.size() );
+    TEST_EQUALITY( 2, neighbors[0].id() );
+    TEST_EQUALITY( 3, neighbors[1].id() );
+
+    // Make a point outside of all the boxes.
+    point[2] = 5.1;
+    coarse_local_search.search( point(), plist, neighbors );
+    TEST_EQUALITY( 0, neighbors.size() );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CoarseLocalSearch, bounding_box_cache_test )
+{
+    using namespace DataTransferKit;
+
+    // Make an entity set.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    Teuchos::RCP<EntitySet> entity_set =
+        Teuchos::rcp( new BasicEntitySet( comm, 3 ) );
+
+    // Add some boxes to the set.
+    int num_boxes = 5;
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        Teuchos::rcp_dynamic_cast<BasicEntitySet>( entity_set )
+            ->addEntity( BoxGeometry( i, comm->getRank(), i, 0.0, 0.0, i, 1.0,
+                                      1.0, i + 1 ) );
+    }
+
+    // Construct a local map for the boxes.
+    Teuchos::RCP<EntityLocalMap> local_map =
+        Teuchos::rcp( new BasicGeometryLocalMap() );
+
+    // Cache the bounding boxes of all the boxes and check them.
+    EntityIterator all_it = entity_set->entityIterator( 3 );
+    Teuchos::RCP<EntityBoundingBoxCache> box_cache =
+        Teuchos::rcp( new EntityBoundingBoxCache( all_it ) );
+    TEST_EQUALITY( num_boxes, box_cache->size() );
+    Teuchos::Tuple<double, 6> cached_box;
+    Teuchos::Tuple<double, 6> entity_box;
+    for ( int n = 0; n < num_boxes; ++n )
+    {
+        box_cache->boundingBox( n, cached_box );
+        box_cache->entity( n ).boundingBox( entity_box );
+        TEST_COMPARE_ARRAYS( entity_box, cached_box );
+    }
+
+    // Build a coarse local search over the cached boxes.
+    Teuchos::ParameterList plist;
+    plist.set<std::string>( "Coarse Local Search Type", "Bounding Box" );
+    CoarseLocalSearch coarse_local_search( box_cache, local_map, plist );
+
+    // Search by local id.
+    Teuchos::Array<double> point( 3 );
+    point[0] = 0.5;
+    point[1] = 0.5;
+    point[2] = 2.2;
+    Teuchos::Array<unsigned> neighbor_ids;
+    coarse_local_search.searchLocalIds( point(), plist, neighbor_ids );
+    TEST_EQUALITY( 1, neighbor_ids.size() );
+    TEST_EQUALITY( 2, box_cache->entity( neighbor_ids[0] ).id() );
+
+    // Do the fine search with the cached boxes.
+    FineLocalSearch fine_local_search( local_map );
+    Teuchos::Array<Entity> parents;
+    Teuchos::Array<double> reference_coordinates;
+    fine_local_search.search( *box_cache, neighbor_ids(), point(), plist,
+                              parents, reference_coordinates );
+    TEST_EQUALITY( 1, parents.size() );
+    TEST_EQUALITY( 2, parents[0].id() );
+    TEST_EQUALITY( 3, reference_coordinates.size() );
+    TEST_EQUALITY( point[0], reference_coordinates[0] );
+    TEST_EQUALITY( point[1], reference_coordinates[1] );
+    TEST_EQUALITY( point[2], reference_coordinates[2] );
+}
+
 //---------------------------------------------------------------------------//
 // end tstCoarseLocalSearch.cpp
 //---------------------------------------------------------------------------//
@@ -372,6 +372,243 @@ TEUCHOS_UNIT_TEST( ConsistentInterpolationOperator, one_to_one_test )
     TEST_EQUALITY( map_op->getMissedRangeEntityIds().size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( ConsistentInterpolationOperator, update_test )
+{
+    using namespace DataTransferKit;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+    int comm_size = comm->getSize();
+
+    // DOMAIN SETUP
+    // Make a domain entity set.
+    int num_boxes = 5;
+    Teuchos::Array<DataTransferKit::SupportId> box_ids( num_boxes );
+    Teuchos::ArrayRCP<double> box_dofs( num_boxes );
+    Teuchos::Array<Entity> boxes( num_boxes );
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        box_ids[i] = num_boxes * ( comm_size - comm_rank - 1 ) + i;
+        box_dofs[i] = 2.0 * box_ids[i];
+        boxes[i] = BoxGeometry( box_ids[i], comm_rank, box_ids[i], 0.0, 0.0,
+                                box_ids[i], 1.0, 1.0, box_ids[i] + 1.0 );
+    }
+
+    // Make a manager for the domain geometry.
+    DataTransferKit::BasicGeometryManager domain_manager( comm, 3, boxes() );
+
+    // Make a DOF vector for the domain.
+    Teuchos::RCP<DataTransferKit::Field> domain_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            boxes(), 1, box_dofs,
+            DataTransferKit::EntityCenteredField::BLOCKED ) );
+    Teuchos::RCP<Tpetra::MultiVector<double, int, DataTransferKit::SupportId>>
+        domain_dofs = Teuchos::rcp( new DataTransferKit::FieldMultiVector(
+            domain_field, domain_manager.functionSpace()->entitySet() ) );
+
+    // RANGE SETUP
+    // Make a range entity set.
+    int num_points = 5;
+    Teuchos::Array<double> point( 3 );
+    Teuchos::Array<DataTransferKit::SupportId> point_ids( num_points );
+    Teuchos::ArrayRCP<double> point_dofs( num_points );
+    Teuchos::Array<Entity> points( num_points );
+    for ( int i = 0; i < num_points; ++i )
+    {
+        point_ids[i] = num_points * comm_rank + i;
+        point_dofs[i] = 0.0;
+        point[0] = 0.5;
+        point[1] = 0.5;
+        point[2] = point_ids[i] + 0.5;
+        points[i] = Point( point_ids[i], comm_rank, point );
+    }
+
+    // Make a manager for the range geometry.
+    DataTransferKit::BasicGeometryManager range_manager( comm, 3, points() );
+
+    // Make a DOF vector for the range.
+    Teuchos::RCP<DataTransferKit::Field> range_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            points(), 1, point_dofs,
+            DataTransferKit::EntityCenteredField::BLOCKED ) );
+    Teuchos::RCP<Tpetra::MultiVector<double, int, DataTransferKit::SupportId>>
+        range_dofs = Teuchos::rcp( new DataTransferKit::FieldMultiVector(
+            range_field, range_manager.functionSpace()->entitySet() ) );
+
+    // MAPPING
+    // Create a map.
+    Teuchos::RCP<Teuchos::ParameterList> parameters = Teuchos::parameterList();
+    parameters->sublist( "Consistent Interpolation" );
+    Teuchos::ParameterList &search_list = parameters->sublist( "Search" );
+    search_list.set<bool>( "Track Missed Range Entities", true );
+    Teuchos::RCP<ConsistentInterpolationOperator> map_op =
+        Teuchos::rcp( new ConsistentInterpolationOperator(
+            domain_dofs->getMap(), range_dofs->getMap(), *parameters ) );
+
+    // Setup the map.
+    map_op->setup( domain_manager.functionSpace(),
+                   range_manager.functionSpace() );
+
+    // Apply the map.
+    map_op->apply( *domain_dofs, *range_dofs );
+
+    // Check the results of the mapping.
+    for ( int i = 0; i < num_points; ++i )
+    {
+        TEST_EQUALITY( 2.0 * point_ids[i], point_dofs[i] );
+    }
+
+    // Check that no missed points were found.
+    TEST_EQUALITY( map_op->getMissedRangeEntityIds().size(), 0 );
+
+    // Update the map. Nothing has moved so every point should be found in
+    // the same box.
+    map_op->update( domain_manager.functionSpace(),
+                    range_manager.functionSpace() );
+
+    // Change the domain data and apply the map again.
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        box_dofs[i] = 3.0 * box_ids[i];
+    }
+    map_op->apply( *domain_dofs, *range_dofs );
+
+    // Check the results of the mapping.
+    for ( int i = 0; i < num_points; ++i )
+    {
+        TEST_EQUALITY( 3.0 * point_ids[i], point_dofs[i] );
+    }
+
+    // Check that no missed points were found.
+    TEST_EQUALITY( map_op->getMissedRangeEntityIds().size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( ConsistentInterpolationOperator, update_missed_test )
+{
+    using namespace DataTransferKit;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+    int comm_size = comm->getSize();
+
+    // DOMAIN SETUP
+    // Make a domain entity set.
+    int num_boxes = 5;
+    Teuchos::Array<DataTransferKit::SupportId> box_ids( num_boxes );
+    Teuchos::ArrayRCP<double> box_dofs( num_boxes );
+    Teuchos::Array<Entity> boxes( num_boxes );
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        box_ids[i] = num_boxes * ( comm_size - comm_rank - 1 ) + i;
+        box_dofs[i] = 2.0 * box_ids[i];
+        boxes[i] = BoxGeometry( box_ids[i], comm_rank, box_ids[i], 0.0, 0.0,
+                                box_ids[i], 1.0, 1.0, box_ids[i] + 1.0 );
+    }
+
+    // Make a manager for the domain geometry.
+    DataTransferKit::BasicGeometryManager domain_manager( comm, 3, boxes() );
+
+    // Make a DOF vector for the domain.
+    Teuchos::RCP<DataTransferKit::Field> domain_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            boxes(), 1, box_dofs,
+            DataTransferKit::EntityCenteredField::BLOCKED ) );
+    Teuchos::RCP<Tpetra::MultiVector<double, int, DataTransferKit::SupportId>>
+        domain_dofs = Teuchos::rcp( new DataTransferKit::FieldMultiVector(
+            domain_field, domain_manager.functionSpace()->entitySet() ) );
+
+    // RANGE SETUP
+    // Make a range entity set. The first point on each process starts
+    // outside of the domain.
+    int num_points = 5;
+    Teuchos::Array<double> point( 3 );
+    Teuchos::Array<DataTransferKit::SupportId> point_ids( num_points );
+    Teuchos::ArrayRCP<double> point_dofs( num_points );
+    Teuchos::Array<Entity> points( num_points );
+    for ( int i = 0; i < num_points; ++i )
+    {
+        point_ids[i] = num_points * comm_rank + i;
+        point_dofs[i] = 0.0;
+        point[0] = ( 0 == i ) ? 2.5 : 0.5;
+        point[1] = 0.5;
+        point[2] = point_ids[i] + 0.5;
+        points[i] = Point( point_ids[i], comm_rank, point );
+    }
+
+    // Make a manager for the range geometry.
+    DataTransferKit::BasicGeometryManager range_manager( comm, 3, points() );
+
+    // Make a DOF vector for the range.
+    Teuchos::RCP<DataTransferKit::Field> range_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            points(), 1, point_dofs,
+            DataTransferKit::EntityCenteredField::BLOCKED ) );
+    Teuchos::RCP<Tpetra::MultiVector<double, int, DataTransferKit::SupportId>>
+        range_dofs = Teuchos::rcp( new DataTransferKit::FieldMultiVector(
+            range_field, range_manager.functionSpace()->entitySet() ) );
+
+    // MAPPING
+    // Create a map.
+    Teuchos::RCP<Teuchos::ParameterList> parameters = Teuchos::parameterList();
+    parameters->sublist( "Consistent Interpolation" );
+    Teuchos::ParameterList &search_list = parameters->sublist( "Search" );
+    search_list.set<bool>( "Track Missed Range Entities", true );
+    Teuchos::RCP<ConsistentInterpolationOperator> map_op =
+        Teuchos::rcp( new ConsistentInterpolationOperator(
+            domain_dofs->getMap(), range_dofs->getMap(), *parameters ) );
+
+    // Setup the map.
+    map_op->setup( domain_manager.functionSpace(),
+                   range_manager.functionSpace() );
+
+    // Check that the first point was missed.
+    Teuchos::ArrayView<const EntityId> missed_ids =
+        map_op->getMissedRangeEntityIds();
+    TEST_EQUALITY( missed_ids.size(), 1 );
+    TEST_EQUALITY( missed_ids[0], point_ids[0] );
+
+    // Move the first point into the domain. The other points keep their
+    // positions.
+    Teuchos::Array<Entity> moved_points( num_points );
+    for ( int i = 0; i < num_points; ++i )
+    {
+        point[0] = 0.5;
+        point[1] = 0.5;
+        point[2] = point_ids[i] + 0.5;
+        moved_points[i] = Point( point_ids[i], comm_rank, point );
+    }
+    DataTransferKit::BasicGeometryManager moved_manager( comm, 3,
+                                                         moved_points() );
+    Teuchos::RCP<DataTransferKit::Field> moved_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            moved_points(), 1, point_dofs,
+            DataTransferKit::EntityCenteredField::BLOCKED ) );
+    Teuchos::RCP<Tpetra::MultiVector<double, int, DataTransferKit::SupportId>>
+        moved_dofs = Teuchos::rcp( new DataTransferKit::FieldMultiVector(
+            moved_field, moved_manager.functionSpace()->entitySet() ) );
+
+    // Update the map. The point that was missed during setup should now be
+    // found.
+    map_op->update( domain_manager.functionSpace(),
+                    moved_manager.functionSpace() );
+    TEST_EQUALITY( map_op->getMissedRangeEntityIds().size(), 0 );
+
+    // Apply the map.
+    map_op->apply( *domain_dofs, *moved_dofs );
+
+    // Check the results of the mapping.
+    for ( int i = 0; i < num_points; ++i )
+    {
+        TEST_EQUALITY( 2.0 * point_ids[i], point_dofs[i] );
+    }
+}
+
 //---------------------------------------------------------------------------//
 TEUCHOS_UNIT_TEST( ConsistentInterpolationOperator, no_domain_0_test )
 {
@@ -0,0 +1,161 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   tstLocalMLSProblem.cpp
+ * \author Stuart R. Slattery
+ * \brief  Local moving least square problem tests.
+ */
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <DTK_LocalMLSProblem.hpp>
+#include <DTK_WendlandBasis.hpp>
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_ArrayView.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+
+//---------------------------------------------------------------------------//
+// TEST EPSILON
+//---------------------------------------------------------------------------//
+
+const double epsilon = 1.0e-10;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// All sources in a plane. The z, xz, yz, and z^2 polynomial columns are
+// linearly dependent on the others and must be dropped while linear and
+// quadratic fields in the plane are still reproduced.
+TEUCHOS_UNIT_TEST( LocalMLSProblem, coplanar_dim_3_test )
+{
+    int dim = 3;
+    int num_x = 5;
+    int num_sources = num_x * num_x;
+    Teuchos::Array<double> sources( dim * num_sources );
+    Teuchos::Array<unsigned> source_lids( num_sources );
+    for ( int j = 0; j < num_x; ++j )
+    {
+        for ( int i = 0; i < num_x; ++i )
+        {
+            int n = i + num_x * j;
+            sources[dim * n] = 0.25 * i;
+            sources[dim * n + 1] = 0.25 * j;
+            sources[dim * n + 2] = 0.5;
+            source_lids[n] = n;
+        }
+    }
+    Teuchos::Array<double> target( dim );
+    target[0] = 0.43;
+    target[1] = 0.61;
+    target[2] = 0.5;
+
+    DataTransferKit::WendlandBasis<2> basis;
+    double radius = 2.0;
+    DataTransferKit::LocalMLSProblem<DataTransferKit::WendlandBasis<2>, 3>
+        problem( target(), source_lids(), sources(), basis, radius );
+    Teuchos::ArrayView<const double> shape_function = problem.shapeFunction();
+    TEST_EQUALITY( num_sources, shape_function.size() );
+
+    auto linear = []( const double *x ) {
+        return 1.0 + x[0] + 2.0 * x[1] + 3.0 * x[2];
+    };
+    auto quadratic = []( const double *x ) {
+        return x[0] * x[1] + x[0] * x[0] - x[1] * x[1];
+    };
+    double linear_value = 0.0;
+    double quadratic_value = 0.0;
+    for ( int n = 0; n < num_sources; ++n )
+    {
+        TEST_ASSERT( std::isfinite( shape_function[n] ) );
+        linear_value += shape_function[n] * linear( &sources[dim * n] );
+        quadratic_value += shape_function[n] * quadratic( &sources[dim * n] );
+    }
+    TEST_FLOATING_EQUALITY( linear( target.getRawPtr() ), linear_value,
+                            epsilon );
+    TEST_FLOATING_EQUALITY( quadratic( target.getRawPtr() ), quadratic_value,
+                            epsilon );
+}
+
+//---------------------------------------------------------------------------//
+// All sources on a line. The y polynomial column and the quadratic columns
+// beyond the first are linearly dependent and must be dropped while linear
+// and quadratic fields along the line are still reproduced.
+TEUCHOS_UNIT_TEST( LocalMLSProblem, collinear_dim_2_test )
+{
+    int dim = 2;
+    int num_sources = 11;
+    Teuchos::Array<double> sources( dim * num_sources );
+    Teuchos::Array<unsigned> source_lids( num_sources );
+    for ( int n = 0; n < num_sources; ++n )
+    {
+        sources[dim * n] = 0.1 * n;
+        sources[dim * n + 1] = 2.0 * sources[dim * n] + 0.1;
+        source_lids[n] = n;
+    }
+    Teuchos::Array<double> target( dim );
+    target[0] = 0.37;
+    target[1] = 2.0 * target[0] + 0.1;
+
+    DataTransferKit::WendlandBasis<2> basis;
+    double radius = 2.0;
+    DataTransferKit::LocalMLSProblem<DataTransferKit::WendlandBasis<2>, 2>
+        problem( target(), source_lids(), sources(), basis, radius );
+    Teuchos::ArrayView<const double> shape_function = problem.shapeFunction();
+    TEST_EQUALITY( num_sources, shape_function.size() );
+
+    auto linear = []( const double *x ) { return 1.0 + x[0] + 2.0 * x[1]; };
+    auto quadratic = []( const double *x ) { return x[0] * x[0]; };
+    double linear_value = 0.0;
+    double quadratic_value = 0.0;
+    for ( int n = 0; n < num_sources; ++n )
+    {
+        TEST_ASSERT( std::isfinite( shape_function[n] ) );
+        linear_value += shape_function[n] * linear( &sources[dim * n] );
+        quadratic_value += shape_function[n] * quadratic( &sources[dim * n] );
+    }
+    TEST_FLOATING_EQUALITY( linear( target.getRawPtr() ), linear_value,
+                            epsilon );
+    TEST_FLOATING_EQUALITY( quadratic( target.getRawPtr() ), quadratic_value,
+                            epsilon );
+}
+
+//---------------------------------------------------------------------------//
+// end tstLocalMLSProblem.cpp
+//---------------------------------------------------------------------------//
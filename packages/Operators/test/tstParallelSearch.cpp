@@ -986,6 +986,238 @@ TEUCHOS_UNIT_TEST( ParallelSearch, local_missed_range_test )
                    Teuchos::as<EntityId>( num_points * comm_rank + 1000 ) );
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( ParallelSearch, threaded_local_search_test )
+{
+    using namespace DataTransferKit;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+
+    // Make a domain entity set of stacked boxes.
+    Teuchos::RCP<EntitySet> domain_set =
+        Teuchos::rcp( new BasicEntitySet( comm, 3 ) );
+    int num_boxes = 20;
+    int id = 0;
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        id = num_boxes * comm_rank + i;
+        Teuchos::rcp_dynamic_cast<BasicEntitySet>( domain_set )
+            ->addEntity( BoxGeometry( id, comm_rank, id, 0.0, 0.0, id, 1.0, 1.0,
+                                      id + 1.0 ) );
+    }
+    EntityIterator domain_it = domain_set->entityIterator( 3 );
+    Teuchos::RCP<EntityLocalMap> domain_map =
+        Teuchos::rcp( new BasicGeometryLocalMap() );
+
+    // Make a range entity set of points. Some points are on box faces and
+    // will be found in two boxes.
+    Teuchos::RCP<EntitySet> range_set =
+        Teuchos::rcp( new BasicEntitySet( comm, 3 ) );
+    int num_points = 4 * num_boxes;
+    Teuchos::Array<double> point( 3 );
+    for ( int i = 0; i < num_points; ++i )
+    {
+        id = num_points * comm_rank + i;
+        point[0] = 0.5;
+        point[1] = 0.5;
+        point[2] = num_boxes * comm_rank + 0.25 * i;
+        Teuchos::rcp_dynamic_cast<BasicEntitySet>( range_set )
+            ->addEntity( Point( id, comm_rank, point ) );
+    }
+    EntityIterator range_it = range_set->entityIterator( 0 );
+    Teuchos::RCP<EntityLocalMap> range_map =
+        Teuchos::rcp( new BasicGeometryLocalMap() );
+
+    // Do a serial and a threaded search.
+    Teuchos::ParameterList serial_list;
+    serial_list.set<bool>( "Track Missed Range Entities", true );
+    ParallelSearch serial_search( comm, 3, domain_it, domain_map,
+                                  serial_list );
+    serial_search.search( range_it, range_map, serial_list );
+
+    // The threaded search requires a thread-safe Teuchos build.
+    Teuchos::ParameterList threaded_list;
+    threaded_list.set<bool>( "Track Missed Range Entities", true );
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+    threaded_list.set<bool>( "Threaded Local Search", true );
+#endif
+    ParallelSearch threaded_search( comm, 3, domain_it, domain_map,
+                                    threaded_list );
+    threaded_search.search( range_it, range_map, threaded_list );
+
+    // Check that the results are the same in the domain decomposition.
+    Teuchos::Array<EntityId> serial_range;
+    Teuchos::Array<EntityId> threaded_range;
+    Teuchos::ArrayView<const double> serial_coords;
+    Teuchos::ArrayView<const double> threaded_coords;
+    for ( domain_it = domain_it.begin(); domain_it != domain_it.end();
+          ++domain_it )
+    {
+        serial_search.getRangeEntitiesFromDomain( domain_it->id(),
+                                                  serial_range );
+        threaded_search.getRangeEntitiesFromDomain( domain_it->id(),
+                                                    threaded_range );
+        std::sort( serial_range.begin(), serial_range.end() );
+        std::sort( threaded_range.begin(), threaded_range.end() );
+        TEST_COMPARE_ARRAYS( serial_range, threaded_range );
+
+        for ( auto range_id : serial_range )
+        {
+            TEST_EQUALITY( serial_search.rangeEntityOwnerRank( range_id ),
+                           threaded_search.rangeEntityOwnerRank( range_id ) );
+            serial_search.rangeParametricCoordinatesInDomain(
+                domain_it->id(), range_id, serial_coords );
+            threaded_search.rangeParametricCoordinatesInDomain(
+                domain_it->id(), range_id, threaded_coords );
+            TEST_COMPARE_ARRAYS( serial_coords, threaded_coords );
+        }
+    }
+
+    // Check that the results are the same in the range decomposition.
+    Teuchos::Array<EntityId> serial_domain;
+    Teuchos::Array<EntityId> threaded_domain;
+    for ( range_it = range_it.begin(); range_it != range_it.end(); ++range_it )
+    {
+        serial_search.getDomainEntitiesFromRange( range_it->id(),
+                                                  serial_domain );
+        threaded_search.getDomainEntitiesFromRange( range_it->id(),
+                                                    threaded_domain );
+        std::sort( serial_domain.begin(), serial_domain.end() );
+        std::sort( threaded_domain.begin(), threaded_domain.end() );
+        TEST_COMPARE_ARRAYS( serial_domain, threaded_domain );
+    }
+
+    // Check the missed entities.
+    Teuchos::Array<EntityId> serial_missed(
+        serial_search.getMissedRangeEntityIds() );
+    Teuchos::Array<EntityId> threaded_missed(
+        threaded_search.getMissedRangeEntityIds() );
+    std::sort( serial_missed.begin(), serial_missed.end() );
+    std::sort( threaded_missed.begin(), threaded_missed.end() );
+    TEST_COMPARE_ARRAYS( serial_missed, threaded_missed );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( ParallelSearch, graph_test )
+{
+    using namespace DataTransferKit;
+
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+    int comm_size = comm->getSize();
+
+    // Make a domain entity set of stacked boxes in reverse rank order.
+    Teuchos::RCP<EntitySet> domain_set =
+        Teuchos::rcp( new BasicEntitySet( comm, 3 ) );
+    int num_boxes = 5;
+    int id = 0;
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        id = num_boxes * ( comm_size - comm_rank - 1 ) + i;
+        Teuchos::rcp_dynamic_cast<BasicEntitySet>( domain_set )
+            ->addEntity( BoxGeometry( id, comm_rank, id, 0.0, 0.0, id, 1.0, 1.0,
+                                      id + 1.0 ) );
+    }
+    EntityIterator domain_it = domain_set->entityIterator( 3 );
+    Teuchos::RCP<EntityLocalMap> domain_map =
+        Teuchos::rcp( new BasicGeometryLocalMap() );
+
+    // Make a range entity set of points. Some points are on box faces and
+    // will be found in two boxes.
+    Teuchos::RCP<EntitySet> range_set =
+        Teuchos::rcp( new BasicEntitySet( comm, 3 ) );
+    int num_points = 2 * num_boxes;
+    Teuchos::Array<double> point( 3 );
+    for ( int i = 0; i < num_points; ++i )
+    {
+        id = num_points * comm_rank + i;
+        point[0] = 0.5;
+        point[1] = 0.5;
+        point[2] = num_boxes * comm_rank + 0.5 * i;
+        Teuchos::rcp_dynamic_cast<BasicEntitySet>( range_set )
+            ->addEntity( Point( id, comm_rank, point ) );
+    }
+    EntityIterator range_it = range_set->entityIterator( 0 );
+    Teuchos::RCP<EntityLocalMap> range_map =
+        Teuchos::rcp( new BasicGeometryLocalMap() );
+
+    // Do the search.
+    Teuchos::ParameterList plist;
+    ParallelSearch parallel_search( comm, 3, domain_it, domain_map, plist );
+    parallel_search.search( range_it, range_map, plist );
+
+    // Check the domain-to-range graph against the entity queries.
+    Teuchos::ArrayView<const EntityId> domain_ids;
+    Teuchos::ArrayView<const int> domain_offsets;
+    Teuchos::ArrayView<const EntityId> range_ids;
+    Teuchos::ArrayView<const int> range_ranks;
+    Teuchos::ArrayView<const double> parametric_coords;
+    parallel_search.getDomainToRangeGraph( domain_ids, domain_offsets,
+                                           range_ids, range_ranks,
+                                           parametric_coords );
+    TEST_EQUALITY( domain_ids.size(), num_boxes );
+    TEST_EQUALITY( domain_offsets.size(), domain_ids.size() + 1 );
+    TEST_EQUALITY( domain_offsets.back(), range_ids.size() );
+    TEST_EQUALITY( range_ranks.size(), range_ids.size() );
+    TEST_EQUALITY( parametric_coords.size(), 3 * range_ids.size() );
+    TEST_ASSERT( std::is_sorted( domain_ids.begin(), domain_ids.end() ) );
+    Teuchos::Array<EntityId> range_entities;
+    Teuchos::ArrayView<const double> range_coords;
+    for ( int i = 0; i < domain_ids.size(); ++i )
+    {
+        parallel_search.getRangeEntitiesFromDomain( domain_ids[i],
+                                                    range_entities );
+        TEST_COMPARE_ARRAYS(
+            range_entities(),
+            range_ids( domain_offsets[i],
+                       domain_offsets[i + 1] - domain_offsets[i] ) );
+        for ( int k = domain_offsets[i]; k < domain_offsets[i + 1]; ++k )
+        {
+            TEST_EQUALITY(
+                range_ranks[k],
+                parallel_search.rangeEntityOwnerRank( range_ids[k] ) );
+            parallel_search.rangeParametricCoordinatesInDomain(
+                domain_ids[i], range_ids[k], range_coords );
+            TEST_COMPARE_ARRAYS( range_coords, parametric_coords( 3 * k, 3 ) );
+        }
+    }
+
+    // Check the range-to-domain graph against the entity queries.
+    Teuchos::ArrayView<const int> range_offsets;
+    Teuchos::ArrayView<const int> domain_ranks;
+    parallel_search.getRangeToDomainGraph( range_ids, range_offsets,
+                                           domain_ids, domain_ranks );
+    TEST_EQUALITY( range_ids.size(), num_points );
+    TEST_EQUALITY( range_offsets.size(), range_ids.size() + 1 );
+    TEST_EQUALITY( range_offsets.back(), domain_ids.size() );
+    TEST_EQUALITY( domain_ranks.size(), domain_ids.size() );
+    TEST_ASSERT( std::is_sorted( range_ids.begin(), range_ids.end() ) );
+    Teuchos::Array<EntityId> domain_entities;
+    for ( int i = 0; i < range_ids.size(); ++i )
+    {
+        parallel_search.getDomainEntitiesFromRange( range_ids[i],
+                                                    domain_entities );
+        TEST_COMPARE_ARRAYS(
+            domain_entities(),
+            domain_ids( range_offsets[i],
+                        range_offsets[i + 1] - range_offsets[i] ) );
+        for ( int k = range_offsets[i]; k < range_offsets[i + 1]; ++k )
+        {
+            TEST_EQUALITY(
+                domain_ranks[k],
+                parallel_search.domainEntityOwnerRank( domain_ids[k] ) );
+            TEST_EQUALITY( domain_ranks[k],
+                           comm_size - 1 -
+                               Teuchos::as<int>( domain_ids[k] ) / num_boxes );
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end tstParallelSearch.cpp
 //---------------------------------------------------------------------------//
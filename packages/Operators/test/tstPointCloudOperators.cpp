@@ -70,11 +70,14 @@
 const double epsilon = 1.0e-8;
 
 //---------------------------------------------------------------------------//
-// Test dirver.
+// Test dirver. With sparse sources the domain points only fill the lower
+// corner of each process' cube and the range points lie on its diagonal so
+// some of them are far from every source.
 //---------------------------------------------------------------------------//
 void setupAndRunTest( const std::string &input_file,
                       Teuchos::Array<double> &gold_data,
-                      Teuchos::Array<double> &test_result )
+                      Teuchos::Array<double> &test_result,
+                      const bool sparse_sources = false )
 {
     // Get the test parameters.
     Teuchos::RCP<Teuchos::ParameterList> parameters =
@@ -98,18 +101,20 @@ void setupAndRunTest( const std::string &input_file,
     // comm_rank-comm_rank+1 in x. The value of the field we are transferring
     // is the x + y + z coordinate of the points.
     int num_points = 10;
-    int domain_mult = 100;
+    int domain_mult = sparse_sources ? 12 : 100;
     int num_domain_points = num_points * domain_mult;
     Teuchos::Array<DataTransferKit::Entity> domain_points( num_domain_points );
     Teuchos::Array<double> coords( space_dim );
     DataTransferKit::EntityId point_id = 0;
     Teuchos::ArrayRCP<double> domain_data( field_dim * num_domain_points );
+    double domain_width = sparse_sources ? 0.5 : 1.0;
     for ( int i = 0; i < num_domain_points; ++i )
     {
         point_id = num_domain_points * comm_rank + i;
-        coords[0] = (double)std::rand() / (double)RAND_MAX + comm_rank;
-        coords[1] = (double)std::rand() / (double)RAND_MAX;
-        coords[2] = (double)std::rand() / (double)RAND_MAX;
+        coords[0] = domain_width * (double)std::rand() / (double)RAND_MAX +
+                    comm_rank;
+        coords[1] = domain_width * (double)std::rand() / (double)RAND_MAX;
+        coords[2] = domain_width * (double)std::rand() / (double)RAND_MAX;
         domain_points[i] =
             DataTransferKit::Point( point_id, comm_rank, coords );
         domain_data[i] = coords[0] + coords[1] + coords[2];
@@ -124,9 +129,18 @@ void setupAndRunTest( const std::string &input_file,
     for ( int i = 0; i < num_points; ++i )
     {
         point_id = num_points * inverse_rank + i + 1;
-        coords[0] = (double)std::rand() / (double)RAND_MAX + inverse_rank;
-        coords[1] = (double)std::rand() / (double)RAND_MAX;
-        coords[2] = (double)std::rand() / (double)RAND_MAX;
+        if ( sparse_sources )
+        {
+            coords[1] = ( i + 0.5 ) / num_points;
+            coords[2] = coords[1];
+            coords[0] = coords[1] + inverse_rank;
+        }
+        else
+        {
+            coords[0] = (double)std::rand() / (double)RAND_MAX + inverse_rank;
+            coords[1] = (double)std::rand() / (double)RAND_MAX;
+            coords[2] = (double)std::rand() / (double)RAND_MAX;
+        }
         range_points[i] = DataTransferKit::Point( point_id, comm_rank, coords );
         test_result[i] = 0.0;
         gold_data[i] = coords[0] + coords[1] + coords[2];
@@ -209,6 +223,80 @@ TEUCHOS_UNIT_TEST( SplineInterpolationOperator, spline_knn_test )
     }
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( SplineInterpolationOperator, spline_block_jacobi_test )
+{
+    // Run the test.
+    Teuchos::Array<double> gold_data;
+    Teuchos::Array<double> test_result;
+    setupAndRunTest( "spline_interpolation_test_block_jacobi.xml", gold_data,
+                     test_result );
+
+    // Check the results.
+    TEST_EQUALITY( gold_data.size(), test_result.size() );
+    int num_points = gold_data.size();
+    for ( int i = 0; i < num_points; ++i )
+    {
+        TEST_FLOATING_EQUALITY( gold_data[i], test_result[i], epsilon );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( SplineInterpolationOperator, spline_pou_test )
+{
+    // Run the test.
+    Teuchos::Array<double> gold_data;
+    Teuchos::Array<double> test_result;
+    setupAndRunTest( "spline_interpolation_test_pou.xml", gold_data,
+                     test_result );
+
+    // Check the results.
+    TEST_EQUALITY( gold_data.size(), test_result.size() );
+    int num_points = gold_data.size();
+    for ( int i = 0; i < num_points; ++i )
+    {
+        TEST_FLOATING_EQUALITY( gold_data[i], test_result[i], epsilon );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( SplineInterpolationOperator, spline_pou_knn_test )
+{
+    // Run the test.
+    Teuchos::Array<double> gold_data;
+    Teuchos::Array<double> test_result;
+    setupAndRunTest( "spline_interpolation_test_pou_knn.xml", gold_data,
+                     test_result );
+
+    // Check the results.
+    TEST_EQUALITY( gold_data.size(), test_result.size() );
+    int num_points = gold_data.size();
+    for ( int i = 0; i < num_points; ++i )
+    {
+        TEST_FLOATING_EQUALITY( gold_data[i], test_result[i], epsilon );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( SplineInterpolationOperator, spline_pou_sparse_test )
+{
+    // Run the test. The patches about the range points far from the sources
+    // have no sources so those points take the interpolant of the nearest
+    // solved patch. It still reproduces the linear field.
+    Teuchos::Array<double> gold_data;
+    Teuchos::Array<double> test_result;
+    setupAndRunTest( "spline_interpolation_test_pou.xml", gold_data,
+                     test_result, true );
+
+    // Check the results.
+    TEST_EQUALITY( gold_data.size(), test_result.size() );
+    int num_points = gold_data.size();
+    for ( int i = 0; i < num_points; ++i )
+    {
+        TEST_FLOATING_EQUALITY( gold_data[i], test_result[i], epsilon );
+    }
+}
+
 //---------------------------------------------------------------------------//
 TEUCHOS_UNIT_TEST( MovingLeastSquareReconstructionOperator, mls_radius_test )
 {
@@ -77,6 +77,50 @@ Teuchos::RCP<const Teuchos::Comm<Ordinal>> getDefaultComm()
 
 const double epsilon = 100.0 * std::numeric_limits<double>::epsilon();
 
+//---------------------------------------------------------------------------//
+// Check the batched basis evaluation against the scalar evaluation.
+template <class BasisType, int DIM>
+void checkBatchedValues( Teuchos::FancyOStream &out, bool &success )
+{
+    typedef DataTransferKit::RadialBasisPolicy<BasisType> BP;
+    Teuchos::RCP<BasisType> basis = BP::create();
+
+    // Some of the neighbors are outside of the radius.
+    int num_centers = 20;
+    Teuchos::Array<double> centers( DIM * num_centers );
+    for ( int i = 0; i < num_centers; ++i )
+    {
+        for ( int d = 0; d < DIM; ++d )
+        {
+            centers[DIM * i + d] = 0.1 * i + 0.03 * d;
+        }
+    }
+    Teuchos::Array<unsigned> neighbor_ids( num_centers );
+    for ( int i = 0; i < num_centers; ++i )
+    {
+        neighbor_ids[i] = num_centers - 1 - i;
+    }
+    Teuchos::Array<double> center( DIM, 0.55 );
+    double radius = 0.9;
+
+    Teuchos::Array<double> packed( DIM * num_centers );
+    DataTransferKit::packRadialBasisNeighbors<DIM>(
+        centers.getRawPtr(), neighbor_ids.getRawPtr(), num_centers,
+        packed.getRawPtr() );
+    Teuchos::Array<double> values( num_centers );
+    BP::template evaluateValues<DIM>( *basis, radius, center.getRawPtr(),
+                                      packed.getRawPtr(), num_centers,
+                                      values.getRawPtr() );
+
+    for ( int j = 0; j < num_centers; ++j )
+    {
+        double dist = DataTransferKit::EuclideanDistance<DIM>::distance(
+            center.getRawPtr(), &centers[DIM * neighbor_ids[j]] );
+        double gold_value = BP::evaluateValue( *basis, radius, dist );
+        TEST_FLOATING_EQUALITY( gold_value, values[j], epsilon );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -471,6 +515,18 @@ TEUCHOS_UNIT_TEST( WuBasis, wu_basis_order_4 )
     TEST_EQUALITY( 0.0, basis_grad );
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( RadialBasisPolicy, batched_values )
+{
+    checkBatchedValues<DataTransferKit::WendlandBasis<0>, 1>( out, success );
+    checkBatchedValues<DataTransferKit::WendlandBasis<2>, 2>( out, success );
+    checkBatchedValues<DataTransferKit::WendlandBasis<4>, 3>( out, success );
+    checkBatchedValues<DataTransferKit::WendlandBasis<6>, 3>( out, success );
+    checkBatchedValues<DataTransferKit::WuBasis<2>, 2>( out, success );
+    checkBatchedValues<DataTransferKit::WuBasis<4>, 3>( out, success );
+    checkBatchedValues<DataTransferKit::BuhmannBasis<3>, 3>( out, success );
+}
+
 //---------------------------------------------------------------------------//
 // end tstRadialBasis.cpp
 //---------------------------------------------------------------------------//
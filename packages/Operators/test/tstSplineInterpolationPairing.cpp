@@ -98,7 +98,7 @@ TEUCHOS_UNIT_TEST( SplineInterpolationPairing, radius_dim_1_test )
     double radius = 1.1;
 
     DataTransferKit::SplineInterpolationPairing<1> pairing(
-        src_coords(), tgt_coords(), false, 0, radius );
+        src_coords(), tgt_coords(), false, 0, radius, false );
 
     Teuchos::ArrayView<const unsigned> view = pairing.childCenterIds( 0 );
     TEST_EQUALITY( 3, view.size() );
@@ -147,7 +147,7 @@ TEUCHOS_UNIT_TEST( SplineInterpolationPairing, radius_dim_2_test )
     double radius = 1.1;
 
     DataTransferKit::SplineInterpolationPairing<2> pairing(
-        src_coords(), tgt_coords(), false, 0, radius );
+        src_coords(), tgt_coords(), false, 0, radius, false );
 
     Teuchos::ArrayView<const unsigned> view = pairing.childCenterIds( 0 );
     TEST_EQUALITY( 3, view.size() );
@@ -199,7 +199,7 @@ TEUCHOS_UNIT_TEST( SplineInterpolationPairing, radius_dim_3_test )
     double radius = 1.1;
 
     DataTransferKit::SplineInterpolationPairing<3> pairing(
-        src_coords(), tgt_coords(), false, 0, radius );
+        src_coords(), tgt_coords(), false, 0, radius, false );
 
     Teuchos::ArrayView<const unsigned> view = pairing.childCenterIds( 0 );
     TEST_EQUALITY( 3, view.size() );
@@ -245,7 +245,7 @@ TEUCHOS_UNIT_TEST( SplineInterpolationPairing, knn_dim_1_test )
     unsigned knn = 3;
 
     DataTransferKit::SplineInterpolationPairing<1> pairing(
-        src_coords(), tgt_coords(), true, knn, 0.0 );
+        src_coords(), tgt_coords(), true, knn, 0.0, false );
 
     Teuchos::ArrayView<const unsigned> view = pairing.childCenterIds( 0 );
     TEST_EQUALITY( knn, view.size() );
@@ -296,7 +296,7 @@ TEUCHOS_UNIT_TEST( SplineInterpolationPairing, knn_dim_2_test )
     unsigned knn = 3;
 
     DataTransferKit::SplineInterpolationPairing<2> pairing(
-        src_coords(), tgt_coords(), true, knn, 0.0 );
+        src_coords(), tgt_coords(), true, knn, 0.0, false );
 
     Teuchos::ArrayView<const unsigned> view = pairing.childCenterIds( 0 );
     TEST_EQUALITY( knn, view.size() );
@@ -350,7 +350,7 @@ TEUCHOS_UNIT_TEST( SplineInterpolationPairing, knn_dim_3_test )
     unsigned knn = 3;
 
     DataTransferKit::SplineInterpolationPairing<3> pairing(
-        src_coords(), tgt_coords(), true, knn, 0.0 );
+        src_coords(), tgt_coords(), true, knn, 0.0, false );
 
     Teuchos::ArrayView<const unsigned> view = pairing.childCenterIds( 0 );
     TEST_EQUALITY( knn, view.size() );
@@ -376,6 +376,63 @@ TEUCHOS_UNIT_TEST( SplineInterpolationPairing, knn_dim_3_test )
     TEST_FLOATING_EQUALITY( 1.01 * 3.0, radius, epsilon );
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( SplineInterpolationPairing, many_parents_test )
+{
+    // Use enough parents that a threaded search is split into several
+    // blocks.
+    int dim = 2;
+    int num_points = 2000;
+    Teuchos::Array<double> src_coords( dim * num_points );
+    Teuchos::Array<double> tgt_coords( dim * num_points );
+    for ( int i = 0; i < num_points; ++i )
+    {
+        src_coords[dim * i] = 1.0 * i;
+        src_coords[dim * i + 1] = 1.0;
+        tgt_coords[dim * i] = 1.0 * i + 0.4;
+        tgt_coords[dim * i + 1] = 1.0;
+    }
+
+    // Radius search. Every parent but the last finds its two closest
+    // children.
+    double radius = 1.1;
+    DataTransferKit::SplineInterpolationPairing<2> radius_pairing(
+        src_coords(), tgt_coords(), false, 0, radius, true );
+    Teuchos::ArrayRCP<DataTransferKit::EntityId> children_per_parent =
+        radius_pairing.childrenPerParent();
+    TEST_EQUALITY( num_points, children_per_parent.size() );
+    for ( int i = 0; i < num_points; ++i )
+    {
+        Teuchos::ArrayView<const unsigned> view =
+            radius_pairing.childCenterIds( i );
+        unsigned num_children = ( i < num_points - 1 ) ? 2 : 1;
+        TEST_EQUALITY( num_children, view.size() );
+        TEST_EQUALITY( num_children, children_per_parent[i] );
+        TEST_EQUALITY( Teuchos::as<unsigned>( i ), view[0] );
+        if ( i < num_points - 1 )
+        {
+            TEST_EQUALITY( Teuchos::as<unsigned>( i + 1 ), view[1] );
+        }
+        TEST_EQUALITY( radius, radius_pairing.parentSupportRadius( i ) );
+    }
+
+    // kNN search.
+    unsigned knn = 2;
+    DataTransferKit::SplineInterpolationPairing<2> knn_pairing(
+        src_coords(), tgt_coords(), true, knn, 0.0, true );
+    for ( int i = 0; i < num_points - 1; ++i )
+    {
+        Teuchos::ArrayView<const unsigned> view =
+            knn_pairing.childCenterIds( i );
+        TEST_EQUALITY( knn, view.size() );
+        TEST_EQUALITY( Teuchos::as<unsigned>( i ), view[0] );
+        TEST_EQUALITY( Teuchos::as<unsigned>( i + 1 ), view[1] );
+        TEST_FLOATING_EQUALITY( 1.01 * 0.6,
+                                knn_pairing.parentSupportRadius( i ),
+                                1.0e-10 );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end tstSplineInterpolationPairing.cpp
 //---------------------------------------------------------------------------//
@@ -0,0 +1,280 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file DTK_BoundingVolumeHierarchy.cpp
+ * \author Stuart R. Slattery
+ * \brief Bounding volume hierarchy definition.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <limits>
+
+#include "DTK_BoundingVolumeHierarchy.hpp"
+#include "DTK_DBC.hpp"
+
+#include <Teuchos_as.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor.
+ *
+ * \param boxes The interleaved boxes to build the hierarchy with.
+ *
+ * \param max_leaf_size The maximum number of boxes in a leaf.
+ */
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+    const Teuchos::ArrayView<const double> &boxes,
+    const unsigned max_leaf_size )
+    : d_indices( boxes.size() / 6 )
+    , d_boxes( boxes )
+{
+    DTK_REQUIRE( 0 == boxes.size() % 6 );
+
+    // Compute the box centers used to split the nodes. Halve the bounds
+    // first as unused dimensions may span the entire range of double.
+    int num_boxes = d_indices.size();
+    Teuchos::Array<double> centers( 3 * num_boxes );
+    for ( int n = 0; n < num_boxes; ++n )
+    {
+        d_indices[n] = n;
+        for ( int d = 0; d < 3; ++d )
+        {
+            centers[3 * n + d] =
+                0.5 * d_boxes[6 * n + d] + 0.5 * d_boxes[6 * n + d + 3];
+        }
+    }
+
+    // Build the tree. A balanced binary tree has less than twice as many
+    // nodes as leaves.
+    if ( num_boxes > 0 )
+    {
+        unsigned leaf_size = std::max( max_leaf_size, 1u );
+        d_nodes.reserve( 2 * ( num_boxes / leaf_size + 1 ) );
+        buildNode( d_boxes(), centers(), 0, num_boxes, leaf_size );
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Find the boxes that contain a point.
+ *
+ * \param point The point to search with. The first point.size() dimensions
+ * of the boxes are checked.
+ *
+ * \param boxes The local indices of the boxes containing the point in
+ * ascending order.
+ */
+void BoundingVolumeHierarchy::pointSearch(
+    const Teuchos::ArrayView<const double> &point,
+    Teuchos::Array<unsigned> &boxes ) const
+{
+    DTK_REQUIRE( point.size() <= 3 );
+
+    boxes.clear();
+    if ( d_nodes.empty() )
+    {
+        return;
+    }
+
+    // Depth-first traversal. The tree is balanced so the stack depth is
+    // bounded by the logarithm of the number of boxes.
+    int stack[64];
+    int stack_size = 0;
+    stack[stack_size++] = 0;
+    int node_id = 0;
+    unsigned box_id = 0;
+    while ( stack_size > 0 )
+    {
+        node_id = stack[--stack_size];
+        const Node &node = d_nodes[node_id];
+        if ( pointInBox( point, node.box ) )
+        {
+            if ( node.count > 0 )
+            {
+                for ( int i = 0; i < node.count; ++i )
+                {
+                    box_id = d_indices[node.first + i];
+                    if ( pointInBox( point, &d_boxes[6 * box_id] ) )
+                    {
+                        boxes.push_back( box_id );
+                    }
+                }
+            }
+            else
+            {
+                DTK_CHECK( stack_size + 2 <= 64 );
+                stack[stack_size++] = node.right;
+                stack[stack_size++] = node_id + 1;
+            }
+        }
+    }
+
+    std::sort( boxes.begin(), boxes.end() );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Find the boxes that intersect a box.
+ *
+ * \param box The box to search with.
+ *
+ * \param boxes The local indices of the boxes intersecting the box in
+ * ascending order.
+ */
+void BoundingVolumeHierarchy::boxSearch( const Teuchos::Tuple<double, 6> &box,
+                                         Teuchos::Array<unsigned> &boxes ) const
+{
+    boxes.clear();
+    if ( d_nodes.empty() )
+    {
+        return;
+    }
+
+    int stack[64];
+    int stack_size = 0;
+    stack[stack_size++] = 0;
+    int node_id = 0;
+    unsigned box_id = 0;
+    while ( stack_size > 0 )
+    {
+        node_id = stack[--stack_size];
+        const Node &node = d_nodes[node_id];
+        if ( boxesIntersect( box, node.box ) )
+        {
+            if ( node.count > 0 )
+            {
+                for ( int i = 0; i < node.count; ++i )
+                {
+                    box_id = d_indices[node.first + i];
+                    if ( boxesIntersect( box, &d_boxes[6 * box_id] ) )
+                    {
+                        boxes.push_back( box_id );
+                    }
+                }
+            }
+            else
+            {
+                DTK_CHECK( stack_size + 2 <= 64 );
+                stack[stack_size++] = node.right;
+                stack[stack_size++] = node_id + 1;
+            }
+        }
+    }
+
+    std::sort( boxes.begin(), boxes.end() );
+}
+
+//---------------------------------------------------------------------------//
+// Recursively build the subtree over a range of the box indices.
+int BoundingVolumeHierarchy::buildNode(
+    const Teuchos::ArrayView<const double> &boxes,
+    const Teuchos::ArrayView<const double> &centers, const int begin,
+    const int end, const unsigned max_leaf_size )
+{
+    DTK_REQUIRE( begin < end );
+
+    // Bound the boxes and their centers.
+    double max = std::numeric_limits<double>::max();
+    Node node;
+    double center_bounds[6] = {max, max, max, -max, -max, -max};
+    for ( int d = 0; d < 3; ++d )
+    {
+        node.box[d] = max;
+        node.box[d + 3] = -max;
+    }
+    unsigned box_id = 0;
+    for ( int i = begin; i < end; ++i )
+    {
+        box_id = d_indices[i];
+        for ( int d = 0; d < 3; ++d )
+        {
+            node.box[d] = std::min( node.box[d], boxes[6 * box_id + d] );
+            node.box[d + 3] =
+                std::max( node.box[d + 3], boxes[6 * box_id + d + 3] );
+            center_bounds[d] =
+                std::min( center_bounds[d], centers[3 * box_id + d] );
+            center_bounds[d + 3] =
+                std::max( center_bounds[d + 3], centers[3 * box_id + d] );
+        }
+    }
+
+    // Add the node.
+    int node_id = d_nodes.size();
+    node.right = -1;
+    node.first = begin;
+    node.count = end - begin;
+
+    // Small enough for a leaf.
+    if ( Teuchos::as<unsigned>( end - begin ) <= max_leaf_size )
+    {
+        d_nodes.push_back( node );
+        return node_id;
+    }
+
+    // Otherwise split the boxes at the median center of the longest axis.
+    node.count = 0;
+    d_nodes.push_back( node );
+    int axis = 0;
+    for ( int d = 1; d < 3; ++d )
+    {
+        if ( center_bounds[d + 3] - center_bounds[d] >
+             center_bounds[axis + 3] - center_bounds[axis] )
+        {
+            axis = d;
+        }
+    }
+    int mid = begin + ( end - begin ) / 2;
+    std::nth_element( d_indices.begin() + begin, d_indices.begin() + mid,
+                      d_indices.begin() + end,
+                      [&]( const unsigned a, const unsigned b ) {
+                          return centers[3 * a + axis] < centers[3 * b + axis];
+                      } );
+
+    // Build the children. The left child immediately follows its parent.
+    buildNode( boxes, centers, begin, mid, max_leaf_size );
+    int right = buildNode( boxes, centers, mid, end, max_leaf_size );
+    d_nodes[node_id].right = right;
+    return node_id;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// end DTK_BoundingVolumeHierarchy.cpp
+//---------------------------------------------------------------------------//
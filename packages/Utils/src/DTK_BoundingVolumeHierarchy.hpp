@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file DTK_BoundingVolumeHierarchy.hpp
+ * \author Stuart R. Slattery
+ * \brief Bounding volume hierarchy declaration.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_BOUNDINGVOLUMEHIERARCHY_HPP
+#define DTK_BOUNDINGVOLUMEHIERARCHY_HPP
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+#include <Teuchos_Tuple.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \class BoundingVolumeHierarchy
+ * \brief Spatial searching for collections of axis-aligned bounding boxes.
+
+ The hierarchy is built top-down by splitting the box centers at the median
+ of their longest extent until a node holds no more than the maximum leaf
+ size. Boxes follow the DTK convention of
+ (x_min,y_min,z_min,x_max,y_max,z_max) and are stored interleaved. Queries
+ return the local indices of the boxes in the order they were given to the
+ constructor.
+ */
+//---------------------------------------------------------------------------//
+class BoundingVolumeHierarchy
+{
+  public:
+    // Constructor.
+    BoundingVolumeHierarchy( const Teuchos::ArrayView<const double> &boxes,
+                             const unsigned max_leaf_size );
+
+    //! Get the number of boxes in the hierarchy.
+    unsigned numBoxes() const { return d_indices.size(); }
+
+    // Find the boxes that contain a point.
+    void pointSearch( const Teuchos::ArrayView<const double> &point,
+                      Teuchos::Array<unsigned> &boxes ) const;
+
+    // Find the boxes that intersect a box.
+    void boxSearch( const Teuchos::Tuple<double, 6> &box,
+                    Teuchos::Array<unsigned> &boxes ) const;
+
+  private:
+    // Recursively build the subtree over a range of the box indices. Returns
+    // the index of the subtree root.
+    int buildNode( const Teuchos::ArrayView<const double> &boxes,
+                   const Teuchos::ArrayView<const double> &centers,
+                   const int begin, const int end,
+                   const unsigned max_leaf_size );
+
+    // Determine if a point is in a box.
+    inline bool pointInBox( const Teuchos::ArrayView<const double> &point,
+                            const double *box ) const;
+
+    // Determine if two boxes intersect.
+    inline bool boxesIntersect( const Teuchos::Tuple<double, 6> &box_A,
+                                const double *box_B ) const;
+
+  private:
+    // Tree node. Interior nodes have a count of 0 and their left child
+    // immediately follows them. Leaf nodes index a range of d_indices.
+    struct Node
+    {
+        double box[6];
+        int right;
+        int first;
+        int count;
+    };
+
+    // Tree nodes in depth-first order.
+    Teuchos::Array<Node> d_nodes;
+
+    // Box indices sorted into leaf order.
+    Teuchos::Array<unsigned> d_indices;
+
+    // Interleaved input boxes.
+    Teuchos::Array<double> d_boxes;
+};
+
+//---------------------------------------------------------------------------//
+// Inline functions.
+//---------------------------------------------------------------------------//
+// Determine if a point is in a box.
+bool BoundingVolumeHierarchy::pointInBox(
+    const Teuchos::ArrayView<const double> &point, const double *box ) const
+{
+    for ( int d = 0; d < point.size(); ++d )
+    {
+        if ( point[d] < box[d] || point[d] > box[d + 3] )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Determine if two boxes intersect.
+bool BoundingVolumeHierarchy::boxesIntersect(
+    const Teuchos::Tuple<double, 6> &box_A, const double *box_B ) const
+{
+    for ( int d = 0; d < 3; ++d )
+    {
+        if ( box_A[d] > box_B[d + 3] || box_A[d + 3] < box_B[d] )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_BOUNDINGVOLUMEHIERARCHY_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_BoundingVolumeHierarchy.hpp
+//---------------------------------------------------------------------------//
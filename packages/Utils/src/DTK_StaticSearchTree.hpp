@@ -70,6 +70,27 @@ class StaticSearchTree
     virtual Teuchos::Array<unsigned>
     radiusSearch( const Teuchos::ArrayView<const double> &point,
                   const double radius ) const = 0;
+
+    // Perform an n-nearest neighbor search for each point in a set of
+    // interleaved points. The neighbors of point n and their squared
+    // distances are in [offsets[n],offsets[n+1]) sorted by distance.
+    virtual void
+    nnSearch( const Teuchos::ArrayView<const double> &points,
+              const unsigned num_neighbors, const bool threaded,
+              Teuchos::Array<std::size_t> &offsets,
+              Teuchos::Array<unsigned> &neighbors,
+              Teuchos::Array<double> &squared_distances ) const = 0;
+
+    // Perform a nearest neighbor search within a specified radius for each
+    // point in a set of interleaved points. The neighbors of point n and
+    // their squared distances are in [offsets[n],offsets[n+1]) sorted by
+    // distance.
+    virtual void
+    radiusSearch( const Teuchos::ArrayView<const double> &points,
+                  const double radius, const bool threaded,
+                  Teuchos::Array<std::size_t> &offsets,
+                  Teuchos::Array<unsigned> &neighbors,
+                  Teuchos::Array<double> &squared_distances ) const = 0;
 };
 
 //---------------------------------------------------------------------------//
@@ -150,6 +171,26 @@ class NanoflannTree : public StaticSearchTree
     radiusSearch( const Teuchos::ArrayView<const double> &point,
                   const double radius ) const;
 
+    // Perform an n-nearest neighbor search for each point in a set of
+    // points.
+    void nnSearch( const Teuchos::ArrayView<const double> &points,
+                   const unsigned num_neighbors, const bool threaded,
+                   Teuchos::Array<std::size_t> &offsets,
+                   Teuchos::Array<unsigned> &neighbors,
+                   Teuchos::Array<double> &squared_distances ) const;
+
+    // Perform a nearest neighbor search within a specified radius for each
+    // point in a set of points.
+    void radiusSearch( const Teuchos::ArrayView<const double> &points,
+                       const double radius, const bool threaded,
+                       Teuchos::Array<std::size_t> &offsets,
+                       Teuchos::Array<unsigned> &neighbors,
+                       Teuchos::Array<double> &squared_distances ) const;
+
+  private:
+    // Get the number of blocks to split a set of queries into.
+    static int numQueryBlocks( const int num_points, const bool threaded );
+
   private:
     // PointCloud.
     PointCloud<DIM> d_cloud;
@@ -41,9 +41,11 @@
 #ifndef DTK_STATICSEARCHTREE_IMPL_HPP
 #define DTK_STATICSEARCHTREE_IMPL_HPP
 
+#include <algorithm>
 #include <limits>
 
 #include "DTK_DBC.hpp"
+#include "DTK_ThreadedBlocks.hpp"
 
 #include <Teuchos_as.hpp>
 
@@ -201,6 +203,130 @@ NanoflannTree<DIM>::radiusSearch( const Teuchos::ArrayView<const double> &point,
     return neighbors;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Perform an n-nearest neighbor search for each point in a set of
+ * points.
+ */
+template <int DIM>
+void NanoflannTree<DIM>::nnSearch(
+    const Teuchos::ArrayView<const double> &points,
+    const unsigned num_neighbors, const bool threaded,
+    Teuchos::Array<std::size_t> &offsets, Teuchos::Array<unsigned> &neighbors,
+    Teuchos::Array<double> &squared_distances ) const
+{
+    DTK_REQUIRE( 0 == points.size() % DIM );
+    int num_points = points.size() / DIM;
+
+    // A point cannot have more neighbors than there are points in the
+    // cloud. Every point then has the same number of neighbors so the
+    // results can be written in place.
+    std::size_t k = std::min( Teuchos::as<std::size_t>( num_neighbors ),
+                              d_cloud.kdtree_get_point_count() );
+    offsets.resize( num_points + 1 );
+    for ( int n = 0; n < num_points + 1; ++n )
+    {
+        offsets[n] = k * n;
+    }
+    neighbors.resize( k * num_points );
+    squared_distances.resize( k * num_points );
+    if ( 0 == k )
+    {
+        return;
+    }
+
+    const double *point_data = points.getRawPtr();
+    unsigned *neighbor_data = neighbors.getRawPtr();
+    double *distance_data = squared_distances.getRawPtr();
+    int num_blocks = numQueryBlocks( num_points, threaded );
+    forEachBlock(
+        num_points, num_blocks,
+        [&]( const int, const int block_begin, const int block_end ) {
+            for ( int n = block_begin; n < block_end; ++n )
+            {
+                d_tree->knnSearch( point_data + DIM * n, k,
+                                   neighbor_data + k * n,
+                                   distance_data + k * n );
+            }
+        } );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Perform a nearest neighbor search within a specified radius for
+ * each point in a set of points.
+ */
+template <int DIM>
+void NanoflannTree<DIM>::radiusSearch(
+    const Teuchos::ArrayView<const double> &points, const double radius,
+    const bool threaded, Teuchos::Array<std::size_t> &offsets,
+    Teuchos::Array<unsigned> &neighbors,
+    Teuchos::Array<double> &squared_distances ) const
+{
+    DTK_REQUIRE( 0 == points.size() % DIM );
+    int num_points = points.size() / DIM;
+    offsets.resize( num_points + 1 );
+    offsets[0] = 0;
+
+    // The number of neighbors of each point is not known ahead of time so
+    // each block keeps its results in its own buffer. The point counts are
+    // written in place and the buffers are copied in block order once the
+    // offsets are known.
+    const double *point_data = points.getRawPtr();
+    std::size_t *offset_data = offsets.getRawPtr();
+    int num_blocks = numQueryBlocks( num_points, threaded );
+    Teuchos::Array<Teuchos::Array<std::pair<unsigned, double>>> block_pairs(
+        num_blocks );
+    nanoflann::SearchParams params;
+    double l2_radius = radius * radius;
+    forEachBlock(
+        num_points, num_blocks,
+        [&]( const int b, const int block_begin, const int block_end ) {
+            Teuchos::Array<std::pair<unsigned, double>> point_pairs;
+            for ( int n = block_begin; n < block_end; ++n )
+            {
+                d_tree->radiusSearch( point_data + DIM * n, l2_radius,
+                                      point_pairs, params );
+                offset_data[n + 1] = point_pairs.size();
+                block_pairs[b].insert( block_pairs[b].end(),
+                                       point_pairs.begin(), point_pairs.end() );
+            }
+        } );
+
+    // Build the offsets and copy the neighbors.
+    for ( int n = 0; n < num_points; ++n )
+    {
+        offsets[n + 1] += offsets[n];
+    }
+    neighbors.resize( offsets.back() );
+    squared_distances.resize( offsets.back() );
+    auto neighbor_it = neighbors.begin();
+    auto distance_it = squared_distances.begin();
+    for ( auto &pairs : block_pairs )
+    {
+        for ( auto &pair : pairs )
+        {
+            *neighbor_it = pair.first;
+            *distance_it = pair.second;
+            ++neighbor_it;
+            ++distance_it;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the number of blocks to split a set of queries into.
+ */
+template <int DIM>
+int NanoflannTree<DIM>::numQueryBlocks( const int num_points,
+                                        const bool threaded )
+{
+    // Do not thread small sets of queries.
+    const int min_block_size = 256;
+    return numThreadBlocks( num_points, min_block_size, threaded );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \brief DTK_ThreadedBlocks.cpp
+ * \author Stuart R. Slattery
+ * \brief Threaded loops over contiguous blocks of items.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+
+#include "DTK_DBC.hpp"
+#include "DTK_ThreadedBlocks.hpp"
+
+#if HAVE_DTK_OPENMP
+#include <omp.h>
+#endif
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+// Get the number of blocks to split a set of items into for a threaded loop.
+int numThreadBlocks( const int num_items, const int min_block_size,
+                     const bool threaded )
+{
+    DTK_REQUIRE( 0 < min_block_size );
+
+    int num_blocks = 1;
+#if HAVE_DTK_OPENMP
+    if ( threaded )
+    {
+        num_blocks =
+            std::min( omp_get_max_threads(), num_items / min_block_size );
+    }
+#endif
+    return std::max( 1, num_blocks );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// end DTK_ThreadedBlocks.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \brief DTK_ThreadedBlocks.hpp
+ * \author Stuart R. Slattery
+ * \brief Threaded loops over contiguous blocks of items.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_THREADEDBLOCKS_HPP
+#define DTK_THREADEDBLOCKS_HPP
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the number of blocks to split a set of items into for a
+ * threaded loop.
+ *
+ * There is at most one block per available thread and every block has at
+ * least min_block_size items. If DTK is built without OpenMP or threaded is
+ * false there is a single block.
+ *
+ * \param num_items The number of items in the loop.
+ *
+ * \param min_block_size The smallest number of items worth giving a thread.
+ *
+ * \param threaded If false, do not split the items.
+ *
+ * \return The number of blocks, at least 1.
+ */
+int numThreadBlocks( const int num_items, const int min_block_size,
+                     const bool threaded = true );
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Apply a function to contiguous blocks of items with one block per
+ * thread.
+ *
+ * The function is called as block_function( b, begin, end ) with the block
+ * id and the [begin,end) range of the items in the block. The blocks are
+ * only run concurrently if DTK is built with OpenMP. Exceptions thrown by
+ * the function are rethrown once all of the blocks are complete.
+ *
+ * \param num_items The number of items in the loop.
+ *
+ * \param num_blocks The number of blocks to split the items into.
+ *
+ * \param block_function The function to apply to each block.
+ */
+template <class BlockFunction>
+void forEachBlock( const int num_items, const int num_blocks,
+                   const BlockFunction &block_function );
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// Template includes.
+//---------------------------------------------------------------------------//
+
+#include "DTK_ThreadedBlocks_impl.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_THREADEDBLOCKS_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_ThreadedBlocks.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \brief DTK_ThreadedBlocks_impl.hpp
+ * \author Stuart R. Slattery
+ * \brief Threaded loops over contiguous blocks of items.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_THREADEDBLOCKS_IMPL_HPP
+#define DTK_THREADEDBLOCKS_IMPL_HPP
+
+#include <exception>
+#include <vector>
+
+#include "DTK_DBC.hpp"
+
+#include <Teuchos_as.hpp>
+
+#if HAVE_DTK_OPENMP
+#include <omp.h>
+#endif
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+// Apply a function to contiguous blocks of items with one block per thread.
+template <class BlockFunction>
+void forEachBlock( const int num_items, const int num_blocks,
+                   const BlockFunction &block_function )
+{
+    DTK_REQUIRE( 0 < num_blocks );
+
+    std::vector<std::exception_ptr> block_errors( num_blocks );
+
+#if HAVE_DTK_OPENMP
+#pragma omp parallel num_threads( num_blocks ) if ( num_blocks > 1 )
+#endif
+    {
+        // The runtime may give us fewer threads than requested so stride
+        // over the blocks.
+        int thread_id = 0;
+        int team_size = 1;
+#if HAVE_DTK_OPENMP
+        thread_id = omp_get_thread_num();
+        team_size = omp_get_num_threads();
+#endif
+        for ( int b = thread_id; b < num_blocks; b += team_size )
+        {
+            // Exceptions cannot leave a parallel region so keep them and
+            // rethrow after the threads have joined.
+            try
+            {
+                int block_begin =
+                    Teuchos::as<int>( Teuchos::as<long long>( num_items ) *
+                                      b / num_blocks );
+                int block_end =
+                    Teuchos::as<int>( Teuchos::as<long long>( num_items ) *
+                                      ( b + 1 ) / num_blocks );
+                block_function( b, block_begin, block_end );
+            }
+            catch ( ... )
+            {
+                block_errors[b] = std::current_exception();
+            }
+        }
+    }
+
+    // Rethrow any errors from the threads.
+    for ( auto &error : block_errors )
+    {
+        if ( error )
+        {
+            std::rethrow_exception( error );
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+#endif // end DTK_THREADEDBLOCKS_IMPL_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_ThreadedBlocks_impl.hpp
+//---------------------------------------------------------------------------//
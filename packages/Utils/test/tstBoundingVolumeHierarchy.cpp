@@ -0,0 +1,159 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   tstBoundingVolumeHierarchy.cpp
+ * \author Stuart R. Slattery
+ * \brief  Bounding volume hierarchy unit tests.
+ */
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <DTK_BoundingVolumeHierarchy.hpp>
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_as.hpp"
+#include "Teuchos_Tuple.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( BoundingVolumeHierarchy, point_search_test )
+{
+    // Make a row of unit boxes along the x axis that overlap by half.
+    int num_boxes = 10;
+    Teuchos::Array<double> boxes( 6 * num_boxes );
+    for ( int i = 0; i < num_boxes; ++i )
+    {
+        boxes[6 * i] = 0.5 * i;
+        boxes[6 * i + 1] = 0.0;
+        boxes[6 * i + 2] = 0.0;
+        boxes[6 * i + 3] = 0.5 * i + 1.0;
+        boxes[6 * i + 4] = 1.0;
+        boxes[6 * i + 5] = 1.0;
+    }
+
+    int max_leaf_size = 2;
+    DataTransferKit::BoundingVolumeHierarchy bvh( boxes(), max_leaf_size );
+    TEST_EQUALITY( num_boxes, Teuchos::as<int>( bvh.numBoxes() ) );
+
+    Teuchos::Array<double> p( 3 );
+    p[0] = 2.25;
+    p[1] = 0.5;
+    p[2] = 0.5;
+    Teuchos::Array<unsigned> found;
+    bvh.pointSearch( p(), found );
+    TEST_EQUALITY( 2, found.size() );
+    TEST_EQUALITY( 3, found[0] );
+    TEST_EQUALITY( 4, found[1] );
+
+    p[0] = 0.25;
+    bvh.pointSearch( p(), found );
+    TEST_EQUALITY( 1, found.size() );
+    TEST_EQUALITY( 0, found[0] );
+
+    p[0] = 5.75;
+    bvh.pointSearch( p(), found );
+    TEST_EQUALITY( 0, found.size() );
+
+    // Only check the first two dimensions with a 2D point.
+    Teuchos::Array<double> p2( 2 );
+    p2[0] = 4.75;
+    p2[1] = 0.1;
+    bvh.pointSearch( p2(), found );
+    TEST_EQUALITY( 2, found.size() );
+    TEST_EQUALITY( 8, found[0] );
+    TEST_EQUALITY( 9, found[1] );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( BoundingVolumeHierarchy, box_search_test )
+{
+    // Make a 4x4 grid of unit boxes.
+    int num_boxes = 16;
+    Teuchos::Array<double> boxes( 6 * num_boxes );
+    for ( int j = 0; j < 4; ++j )
+    {
+        for ( int i = 0; i < 4; ++i )
+        {
+            int n = 4 * j + i;
+            boxes[6 * n] = i;
+            boxes[6 * n + 1] = j;
+            boxes[6 * n + 2] = 0.0;
+            boxes[6 * n + 3] = i + 1.0;
+            boxes[6 * n + 4] = j + 1.0;
+            boxes[6 * n + 5] = 1.0;
+        }
+    }
+
+    int max_leaf_size = 3;
+    DataTransferKit::BoundingVolumeHierarchy bvh( boxes(), max_leaf_size );
+
+    Teuchos::Array<unsigned> found;
+    Teuchos::Tuple<double, 6> box =
+        Teuchos::tuple( 1.5, 1.5, 0.5, 2.5, 2.5, 0.6 );
+    bvh.boxSearch( box, found );
+    TEST_EQUALITY( 4, found.size() );
+    TEST_EQUALITY( 5, found[0] );
+    TEST_EQUALITY( 6, found[1] );
+    TEST_EQUALITY( 9, found[2] );
+    TEST_EQUALITY( 10, found[3] );
+
+    box = Teuchos::tuple( 4.5, 0.0, 0.0, 5.0, 4.0, 1.0 );
+    bvh.boxSearch( box, found );
+    TEST_EQUALITY( 0, found.size() );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( BoundingVolumeHierarchy, empty_test )
+{
+    Teuchos::Array<double> boxes;
+    DataTransferKit::BoundingVolumeHierarchy bvh( boxes(), 10 );
+    TEST_EQUALITY( 0, Teuchos::as<int>( bvh.numBoxes() ) );
+
+    Teuchos::Array<double> p( 3, 0.0 );
+    Teuchos::Array<unsigned> found( 2 );
+    bvh.pointSearch( p(), found );
+    TEST_EQUALITY( 0, found.size() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstBoundingVolumeHierarchy.cpp
+//---------------------------------------------------------------------------//
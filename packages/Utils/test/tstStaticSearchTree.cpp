@@ -371,6 +371,96 @@ TEUCHOS_UNIT_TEST( NanoflannTree, dim_3_factory_test )
     TEST_EQUALITY( 9, nnearest[0] )
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( NanoflannTree, dim_3_batch_test )
+{
+    int dim = 3;
+    int num_points = 10;
+    int num_coords = dim * num_points * num_points * num_points;
+
+    // Build a grid of points.
+    Teuchos::Array<double> coords( num_coords );
+    int n = 0;
+    for ( int k = 0; k < num_points; ++k )
+    {
+        for ( int j = 0; j < num_points; ++j )
+        {
+            for ( int i = 0; i < num_points; ++i, ++n )
+            {
+                coords[dim * n] = 1.0 * i;
+                coords[dim * n + 1] = 1.0 * j;
+                coords[dim * n + 2] = 1.0 * k;
+            }
+        }
+    }
+
+    int max_leaf_size = 3;
+    Teuchos::RCP<DataTransferKit::StaticSearchTree> tree =
+        DataTransferKit::SearchTreeFactory::createStaticTree( dim, coords(),
+                                                              max_leaf_size );
+
+    // Shift the grid to get a set of query points.
+    int num_queries = num_coords / dim;
+    Teuchos::Array<double> queries( coords );
+    for ( auto &q : queries )
+    {
+        q += 0.23;
+    }
+
+    // Check the batched searches against the single point searches with and
+    // without threads.
+    Teuchos::Array<std::size_t> offsets;
+    Teuchos::Array<unsigned> neighbors;
+    Teuchos::Array<double> squared_distances;
+    Teuchos::Array<unsigned> gold;
+    unsigned num_neighbors = 7;
+    double radius = 1.1;
+    for ( bool threaded : {false, true} )
+    {
+        tree->nnSearch( queries(), num_neighbors, threaded, offsets, neighbors,
+                        squared_distances );
+        TEST_EQUALITY( num_queries + 1, offsets.size() );
+        TEST_EQUALITY( num_neighbors * num_queries, neighbors.size() );
+        TEST_EQUALITY( neighbors.size(), squared_distances.size() );
+        for ( int q = 0; q < num_queries; ++q )
+        {
+            gold = tree->nnSearch( queries( dim * q, dim ), num_neighbors );
+            TEST_COMPARE_ARRAYS( gold(),
+                                 neighbors( offsets[q], num_neighbors ) );
+        }
+
+        tree->radiusSearch( queries(), radius, threaded, offsets, neighbors,
+                            squared_distances );
+        TEST_EQUALITY( num_queries + 1, offsets.size() );
+        TEST_EQUALITY( neighbors.size(), offsets.back() );
+        TEST_EQUALITY( neighbors.size(), squared_distances.size() );
+        for ( int q = 0; q < num_queries; ++q )
+        {
+            gold = tree->radiusSearch( queries( dim * q, dim ), radius );
+            TEST_EQUALITY( gold.size(), offsets[q + 1] - offsets[q] );
+            for ( std::size_t p = offsets[q]; p < offsets[q + 1]; ++p )
+            {
+                TEST_EQUALITY( gold[p - offsets[q]], neighbors[p] );
+                double dist = 0.0;
+                for ( int d = 0; d < dim; ++d )
+                {
+                    double dx = queries[dim * q + d] -
+                                coords[dim * neighbors[p] + d];
+                    dist += dx * dx;
+                }
+                TEST_FLOATING_EQUALITY( dist, squared_distances[p], 1.0e-12 );
+                TEST_ASSERT( squared_distances[p] < radius * radius );
+            }
+        }
+    }
+
+    // Asking for more neighbors than points gives all the points.
+    tree->nnSearch( queries( 0, dim ), num_coords, false, offsets, neighbors,
+                    squared_distances );
+    TEST_EQUALITY( 2, offsets.size() );
+    TEST_EQUALITY( Teuchos::as<std::size_t>( num_queries ), offsets[1] );
+}
+
 //---------------------------------------------------------------------------//
 // end tstStaticSearchTree.cpp
 //---------------------------------------------------------------------------//